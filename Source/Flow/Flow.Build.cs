@@ -24,7 +24,8 @@ public class Flow : ModuleRules
 			"MovieSceneTracks",
 			"NetCore",
 			"Slate",
-			"SlateCore"
+			"SlateCore",
+			"TraceLog"
 		});
 
 		if (target.Type == TargetType.Editor)
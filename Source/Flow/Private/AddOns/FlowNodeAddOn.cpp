@@ -92,6 +92,15 @@ UFlowNode* UFlowNodeAddOn::FindOwningFlowNode() const
 	return ParentFlowNode;
 }
 
+void UFlowNodeAddOn::NotifyPredicateChanged()
+{
+	// AddOns are outered to their parent, either the node or another AddOn
+	if (UFlowNodeBase* Parent = Cast<UFlowNodeBase>(GetOuter()))
+	{
+		Parent->OnChildPredicateChanged(*this);
+	}
+}
+
 int32 UFlowNodeAddOn::GetRandomSeed() const
 {
 	if (ensure(FlowNode))
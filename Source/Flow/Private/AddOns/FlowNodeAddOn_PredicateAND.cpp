@@ -4,6 +4,25 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNodeAddOn_PredicateAND)
 
+namespace FlowPredicateAND
+{
+	// Shared by cached and uncached evaluation, EvaluateAddOn is called only for AddOns implementing the predicate interface
+	bool EvaluateAddOns(const TArray<UFlowNodeAddOn*>& AddOns, TFunctionRef<bool(const UFlowNodeAddOn&)> EvaluateAddOn)
+	{
+		for (int Index = 0; Index < AddOns.Num(); ++Index)
+		{
+			const UFlowNodeAddOn* AddOn = AddOns[Index];
+
+			if (IFlowPredicateInterface::ImplementsInterfaceSafe(AddOn) && !EvaluateAddOn(*AddOn))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
 UFlowNodeAddOn_PredicateAND::UFlowNodeAddOn_PredicateAND()
 	: Super()
 {
@@ -11,6 +30,8 @@ UFlowNodeAddOn_PredicateAND::UFlowNodeAddOn_PredicateAND()
 	NodeDisplayStyle = FlowNodeStyle::AddOn_Predicate_Composite;
 	Category = TEXT("Composite");
 #endif
+
+	bSharedTemplate = true;
 }
 
 EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateAND::AcceptFlowNodeAddOnChild_Implementation(
@@ -29,27 +50,46 @@ EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateAND::AcceptFlowNodeAddOnChild_Imp
 	}
 }
 
+void UFlowNodeAddOn_PredicateAND::OnChildPredicateChanged(UFlowNodeAddOn& Predicate)
+{
+	if (PredicateCache.HandleChildChanged(Predicate, [this]() { return EvaluatePredicateAND(AddOns, PredicateCache); }))
+	{
+		NotifyPredicateChanged();
+	}
+}
+
+void UFlowNodeAddOn_PredicateAND::DeinitializeInstance()
+{
+	PredicateCache.Reset();
+
+	Super::DeinitializeInstance();
+}
+
 bool UFlowNodeAddOn_PredicateAND::EvaluatePredicate_Implementation() const
 {
-	return EvaluatePredicateAND(AddOns);
+	return EvaluatePredicateAND(AddOns, PredicateCache);
+}
+
+bool UFlowNodeAddOn_PredicateAND::IsPredicateObservable_Implementation() const
+{
+	return PredicateCache.AreAllObservable(AddOns);
 }
 
 bool UFlowNodeAddOn_PredicateAND::EvaluatePredicateAND(const TArray<UFlowNodeAddOn*>& AddOns)
 {
-	for (int Index = 0; Index < AddOns.Num(); ++Index)
+	return FlowPredicateAND::EvaluateAddOns(AddOns, [](const UFlowNodeAddOn& AddOn)
 	{
-		const UFlowNodeAddOn* AddOn = AddOns[Index];
-
-		if (IFlowPredicateInterface::ImplementsInterfaceSafe(AddOn))
-		{
-			const bool bResult = IFlowPredicateInterface::Execute_EvaluatePredicate(AddOn);
+		return IFlowPredicateInterface::Execute_EvaluatePredicate(&AddOn);
+	});
+}
 
-			if (!bResult)
-			{
-				return false;
-			}
-		}
-	}
+bool UFlowNodeAddOn_PredicateAND::EvaluatePredicateAND(const TArray<UFlowNodeAddOn*>& AddOns, FFlowPredicateResultCache& Cache)
+{
+	const bool bResult = FlowPredicateAND::EvaluateAddOns(AddOns, [&Cache](const UFlowNodeAddOn& AddOn)
+	{
+		return Cache.Evaluate(AddOn);
+	});
 
-	return true;
+	Cache.LastResult = bResult;
+	return bResult;
 }
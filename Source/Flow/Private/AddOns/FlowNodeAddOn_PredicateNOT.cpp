@@ -11,6 +11,8 @@ UFlowNodeAddOn_PredicateNOT::UFlowNodeAddOn_PredicateNOT()
 	NodeDisplayStyle = FlowNodeStyle::AddOn_Predicate_Composite;
 	Category = TEXT("Composite");
 #endif
+
+	bSharedTemplate = true;
 }
 
 EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateNOT::AcceptFlowNodeAddOnChild_Implementation(
@@ -32,6 +34,21 @@ EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateNOT::AcceptFlowNodeAddOnChild_Imp
 	}
 }
 
+void UFlowNodeAddOn_PredicateNOT::OnChildPredicateChanged(UFlowNodeAddOn& Predicate)
+{
+	if (PredicateCache.HandleChildChanged(Predicate, [this]() { return EvaluatePredicate_Implementation(); }))
+	{
+		NotifyPredicateChanged();
+	}
+}
+
+void UFlowNodeAddOn_PredicateNOT::DeinitializeInstance()
+{
+	PredicateCache.Reset();
+
+	Super::DeinitializeInstance();
+}
+
 bool UFlowNodeAddOn_PredicateNOT::EvaluatePredicate_Implementation() const
 {
 	if (AddOns.IsEmpty())
@@ -59,7 +76,13 @@ bool UFlowNodeAddOn_PredicateNOT::EvaluatePredicate_Implementation() const
 		return true;
 	}
 
-	const bool bResult = !IFlowPredicateInterface::Execute_EvaluatePredicate(SingleChildAddOn);
+	const bool bResult = !PredicateCache.Evaluate(*SingleChildAddOn);
+	PredicateCache.LastResult = bResult;
 
 	return bResult;
+}
+
+bool UFlowNodeAddOn_PredicateNOT::IsPredicateObservable_Implementation() const
+{
+	return PredicateCache.AreAllObservable(AddOns);
 }
\ No newline at end of file
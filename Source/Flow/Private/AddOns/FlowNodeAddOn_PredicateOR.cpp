@@ -4,6 +4,33 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNodeAddOn_PredicateOR)
 
+namespace FlowPredicateOR
+{
+	// Shared by cached and uncached evaluation, EvaluateAddOn is called only for AddOns implementing the predicate interface
+	bool EvaluateAddOns(const TArray<UFlowNodeAddOn*>& AddOns, TFunctionRef<bool(const UFlowNodeAddOn&)> EvaluateAddOn)
+	{
+		// For parity with PredicateAND, the "no AddOns (that qualify)" case results in a "true" result
+		bool bResult = true;
+
+		for (int Index = 0; Index < AddOns.Num(); ++Index)
+		{
+			const UFlowNodeAddOn* AddOn = AddOns[Index];
+
+			if (IFlowPredicateInterface::ImplementsInterfaceSafe(AddOn))
+			{
+				if (EvaluateAddOn(*AddOn))
+				{
+					return true;
+				}
+
+				bResult = false;
+			}
+		}
+
+		return bResult;
+	}
+}
+
 UFlowNodeAddOn_PredicateOR::UFlowNodeAddOn_PredicateOR()
 	: Super()
 {
@@ -11,6 +38,8 @@ UFlowNodeAddOn_PredicateOR::UFlowNodeAddOn_PredicateOR()
 	NodeDisplayStyle = FlowNodeStyle::AddOn_Predicate_Composite;
 	Category = TEXT("Composite");
 #endif
+
+	bSharedTemplate = true;
 }
 
 EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateOR::AcceptFlowNodeAddOnChild_Implementation(
@@ -29,40 +58,46 @@ EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateOR::AcceptFlowNodeAddOnChild_Impl
 	}
 }
 
-bool UFlowNodeAddOn_PredicateOR::EvaluatePredicate_Implementation() const
+void UFlowNodeAddOn_PredicateOR::OnChildPredicateChanged(UFlowNodeAddOn& Predicate)
 {
-	return EvaluatePredicateOR(AddOns);
+	if (PredicateCache.HandleChildChanged(Predicate, [this]() { return EvaluatePredicateOR(AddOns, PredicateCache); }))
+	{
+		NotifyPredicateChanged();
+	}
 }
 
-bool UFlowNodeAddOn_PredicateOR::EvaluatePredicateOR(const TArray<UFlowNodeAddOn*>& AddOns)
+void UFlowNodeAddOn_PredicateOR::DeinitializeInstance()
 {
-	int32 FalseCount = 0;
-	for (int Index = 0; Index < AddOns.Num(); ++Index)
-	{
-		const UFlowNodeAddOn* AddOn = AddOns[Index];
+	PredicateCache.Reset();
 
-		if (IFlowPredicateInterface::ImplementsInterfaceSafe(AddOn))
-		{
-			const bool bResult = IFlowPredicateInterface::Execute_EvaluatePredicate(AddOn);
+	Super::DeinitializeInstance();
+}
 
-			if (bResult)
-			{
-				return true;
-			}
-			else
-			{
-				++FalseCount;
-			}
-		}
-	}
+bool UFlowNodeAddOn_PredicateOR::EvaluatePredicate_Implementation() const
+{
+	return EvaluatePredicateOR(AddOns, PredicateCache);
+}
+
+bool UFlowNodeAddOn_PredicateOR::IsPredicateObservable_Implementation() const
+{
+	return PredicateCache.AreAllObservable(AddOns);
+}
 
-	if (FalseCount == 0)
+bool UFlowNodeAddOn_PredicateOR::EvaluatePredicateOR(const TArray<UFlowNodeAddOn*>& AddOns)
+{
+	return FlowPredicateOR::EvaluateAddOns(AddOns, [](const UFlowNodeAddOn& AddOn)
 	{
-		// For parity with PredicateAND, the "no AddOns (that qualify)" case results in a "true" result
-		return true;
-	}
-	else
+		return IFlowPredicateInterface::Execute_EvaluatePredicate(&AddOn);
+	});
+}
+
+bool UFlowNodeAddOn_PredicateOR::EvaluatePredicateOR(const TArray<UFlowNodeAddOn*>& AddOns, FFlowPredicateResultCache& Cache)
+{
+	const bool bResult = FlowPredicateOR::EvaluateAddOns(AddOns, [&Cache](const UFlowNodeAddOn& AddOn)
 	{
-		return false;
-	}
+		return Cache.Evaluate(AddOn);
+	});
+
+	Cache.LastResult = bResult;
+	return bResult;
 }
@@ -384,3 +384,21 @@ FFlowDataPinResult UFlowAssetParams::TrySupplyDataPin_Implementation(FName PinNa
 
 	return FFlowDataPinResult(EFlowDataPinResolveResult::FailedUnknownPin);
 }
+
+EFlowDataPinResolveResult UFlowAssetParams::TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const
+{
+	const TInstancedStruct<FFlowDataPinValue>* Found = PropertyMap.Find(PinName);
+	if (!Found)
+	{
+		return EFlowDataPinResolveResult::FailedUnknownPin;
+	}
+
+	if (!Found->IsValid())
+	{
+		return EFlowDataPinResolveResult::FailedMismatchedType;
+	}
+
+	FFlowDataPinValueSource Source;
+	Source.DataPinValue = Found->GetPtr();
+	return Request.CopyValue(Source);
+}
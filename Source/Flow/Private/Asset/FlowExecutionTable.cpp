@@ -0,0 +1,111 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Asset/FlowExecutionTable.h"
+#include "FlowLogChannels.h"
+#include "Nodes/FlowNode.h"
+
+#include "UObject/UnrealType.h"
+
+namespace FlowExecutionTable
+{
+	// Instance state of shared nodes is swapped in and out by FMemory::Memswap, so it has to be plain data invisible to GC
+	const FProperty* FindUnshareableSaveGameProperty(const UFlowNode& Node)
+	{
+		for (TFieldIterator<FProperty> It(Node.GetClass()); It; ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_SaveGame))
+			{
+				TArray<const FStructProperty*> EncounteredStructProps;
+				if (!It->HasAnyPropertyFlags(CPF_IsPlainOldData) || It->ContainsObjectReference(EncounteredStructProps))
+				{
+					return *It;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+void FFlowExecutionTable::Compile(const TMap<FGuid, TObjectPtr<UFlowNode>>& Nodes, const bool bShareTemplateNodes /*= false*/)
+{
+	NodeGuids.Reset(Nodes.Num());
+	NodeIndices.Reset();
+	NodeIndices.Reserve(Nodes.Num());
+
+	for (const TPair<FGuid, TObjectPtr<UFlowNode>>& Node : Nodes)
+	{
+		if (IsValid(Node.Value))
+		{
+			NodeIndices.Add(Node.Key, NodeGuids.Add(Node.Key));
+		}
+	}
+
+	FirstOutputEdges.Reset(NodeGuids.Num() + 1);
+	OutputEdges.Reset();
+
+	for (const FGuid& NodeGuid : NodeGuids)
+	{
+		const UFlowNode* Node = Nodes.FindChecked(NodeGuid);
+		FirstOutputEdges.Add(OutputEdges.Num());
+
+		for (const FFlowPin& OutputPin : Node->GetOutputPins())
+		{
+			FFlowExecutionEdge& Edge = OutputEdges.AddDefaulted_GetRef();
+
+			// unconnected pin returns empty guid, which isn't found in the table
+			const FConnectedPin Connection = Node->GetConnection(OutputPin.PinName);
+			const int32 TargetNodeIndex = FindNodeIndex(Connection.NodeGuid);
+			if (TargetNodeIndex != INDEX_NONE)
+			{
+				const UFlowNode* TargetNode = Nodes.FindChecked(Connection.NodeGuid);
+				Edge.NodeIndex = TargetNodeIndex;
+				Edge.PinIndex = TargetNode->GetInputPins().IndexOfByKey(Connection.PinName);
+			}
+		}
+	}
+
+	FirstOutputEdges.Add(OutputEdges.Num());
+
+	SharedNodeIndices.Init(INDEX_NONE, NodeGuids.Num());
+	FirstSharedProperties.Reset();
+	SharedProperties.Reset();
+	SharedStateSize = 0;
+	SharedStateAlignment = 1;
+
+	if (bShareTemplateNodes)
+	{
+		for (int32 NodeIndex = 0; NodeIndex < NodeGuids.Num(); NodeIndex++)
+		{
+			const UFlowNode* Node = Nodes.FindChecked(NodeGuids[NodeIndex]);
+			if (!Node->CanShareTemplate())
+			{
+				continue;
+			}
+
+			if (const FProperty* UnshareableProperty = FlowExecutionTable::FindUnshareableSaveGameProperty(*Node))
+			{
+				UE_LOG(LogFlow, Warning, TEXT("Node %s won't share its template, SaveGame property %s isn't plain data. Flow Asset: %s."),
+					*Node->GetClass()->GetName(), *UnshareableProperty->GetName(), *GetNameSafe(Node->GetOuter()));
+				continue;
+			}
+
+			SharedNodeIndices[NodeIndex] = FirstSharedProperties.Add(SharedProperties.Num());
+
+			for (TFieldIterator<FProperty> It(Node->GetClass()); It; ++It)
+			{
+				if (It->HasAnyPropertyFlags(CPF_SaveGame))
+				{
+					const int32 Alignment = It->GetMinAlignment();
+					SharedStateSize = Align(SharedStateSize, Alignment);
+					SharedStateAlignment = FMath::Max(SharedStateAlignment, Alignment);
+
+					SharedProperties.Add({*It, SharedStateSize});
+					SharedStateSize += It->GetSize();
+				}
+			}
+		}
+	}
+
+	FirstSharedProperties.Add(SharedProperties.Num());
+}
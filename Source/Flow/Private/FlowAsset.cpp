@@ -13,13 +13,15 @@
 #include "Nodes/Graph/FlowNode_CustomOutput.h"
 #include "Nodes/Graph/FlowNode_Start.h"
 #include "Nodes/Graph/FlowNode_SubGraph.h"
+#include "Trace/FlowTrace.h"
+#include "Types/FlowArray.h"
 #include "Types/FlowAutoDataPinsWorkingData.h"
 #include "Types/FlowDataPinValue.h"
 #include "Types/FlowStructUtils.h"
 
+#include "Algo/Reverse.h"
 #include "Engine/World.h"
-#include "Serialization/MemoryReader.h"
-#include "Serialization/MemoryWriter.h"
+#include "TimerManager.h"
 
 #if WITH_EDITOR
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -42,6 +44,10 @@ FString UFlowAsset::ValidationError_NullNodeInstance = TEXT("Node with GUID {0}
 UFlowAsset::UFlowAsset(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bWorldBound(true)
+	, SignalPropagation(EFlowSignalPropagation::Recursive)
+	, SignalsPerFrameBudget(0)
+	, SignalPriority(0)
+	, InstancePoolSize(0)
 #if WITH_EDITORONLY_DATA
 	, FlowGraph(nullptr)
 #endif
@@ -458,6 +464,9 @@ void UFlowAsset::UnregisterNode(const FGuid& NodeGuid)
 
 void UFlowAsset::HarvestNodeConnections(UFlowNode* TargetNode)
 {
+	// running instances keep their copy of the table
+	CompiledExecutionTable.Reset();
+
 	TArray<UFlowNode*> TargetNodes;
 
 	if (IsValid(TargetNode))
@@ -820,6 +829,18 @@ void UFlowAsset::AddInstance(UFlowAsset* Instance)
 	ActiveInstances.Add(Instance);
 }
 
+TSharedPtr<const FFlowExecutionTable> UFlowAsset::GetCompiledExecutionTable()
+{
+	if (!CompiledExecutionTable.IsValid())
+	{
+		const TSharedRef<FFlowExecutionTable> NewExecutionTable = MakeShared<FFlowExecutionTable>();
+		NewExecutionTable->Compile(Nodes, UFlowSettings::Get()->bShareTemplateNodes);
+		CompiledExecutionTable = NewExecutionTable;
+	}
+
+	return CompiledExecutionTable;
+}
+
 int32 UFlowAsset::RemoveInstance(UFlowAsset* Instance)
 {
 #if WITH_EDITOR
@@ -830,6 +851,15 @@ int32 UFlowAsset::RemoveInstance(UFlowAsset* Instance)
 #endif
 
 	ActiveInstances.Remove(Instance);
+
+#if WITH_EDITOR
+	// graph might be edited before starting the next PIE session
+	if (ActiveInstances.Num() == 0)
+	{
+		CompiledExecutionTable.Reset();
+	}
+#endif
+
 	return ActiveInstances.Num();
 }
 
@@ -897,6 +927,116 @@ void UFlowAsset::BroadcastRuntimeMessageAdded(const TSharedRef<FTokenizedMessage
 }
 #endif // WITH_EDITOR
 
+FFlowSharedNodesState::FFlowSharedNodesState(const TSharedRef<const FFlowExecutionTable>& InExecutionTable, TConstArrayView<TObjectPtr<UFlowNode>> IndexedNodes)
+	: ExecutionTable(InExecutionTable)
+{
+	Memory = static_cast<uint8*>(FMemory::Malloc(FMath::Max(ExecutionTable->GetSharedStateSize(), 1), ExecutionTable->GetSharedStateAlignment()));
+	NodeStates.SetNum(ExecutionTable->GetSharedNodesNum());
+
+	for (int32 NodeIndex = 0; NodeIndex < IndexedNodes.Num(); NodeIndex++)
+	{
+		const int32 SharedNodeIndex = ExecutionTable->GetSharedNodeIndex(NodeIndex);
+		if (SharedNodeIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// if another instance has its state swapped into the template, template values wait in that instance's block
+		const UFlowNode* TemplateNode = IndexedNodes[NodeIndex];
+		const FFlowSharedNodesState* SwappedState = TemplateNode->SharedExecutionState.Get();
+		const bool bTemplateSwapped = SwappedState && &SwappedState->ExecutionTable.Get() == &ExecutionTable.Get();
+
+		for (const FFlowSharedNodeProperty& SharedProperty : ExecutionTable->GetSharedProperties(SharedNodeIndex))
+		{
+			void* Value = Memory + SharedProperty.StateOffset;
+			const void* TemplateValue = bTemplateSwapped
+				? static_cast<const void*>(SwappedState->Memory + SharedProperty.StateOffset)
+				: SharedProperty.Property->ContainerPtrToValuePtr<void>(TemplateNode);
+
+			SharedProperty.Property->InitializeValue(Value);
+			SharedProperty.Property->CopyCompleteValue(Value, TemplateValue);
+		}
+	}
+}
+
+FFlowSharedNodesState::~FFlowSharedNodesState()
+{
+	for (const FFlowSharedNodeProperty& SharedProperty : ExecutionTable->GetAllSharedProperties())
+	{
+		SharedProperty.Property->DestroyValue(Memory + SharedProperty.StateOffset);
+	}
+
+	FMemory::Free(Memory);
+}
+
+void FFlowSharedNodesState::Swap(UFlowNode& Node)
+{
+	const int32 SharedNodeIndex = ExecutionTable->GetSharedNodeIndex(Node.ExecutionIndex);
+	check(SharedNodeIndex != INDEX_NONE);
+
+	// property values are plain data, see FFlowExecutionTable::Compile, so swapping their memory swaps the values
+	for (const FFlowSharedNodeProperty& SharedProperty : ExecutionTable->GetSharedProperties(SharedNodeIndex))
+	{
+		FMemory::Memswap(SharedProperty.Property->ContainerPtrToValuePtr<void>(&Node), Memory + SharedProperty.StateOffset, SharedProperty.Property->GetSize());
+	}
+
+	Node.SwapInstanceState(NodeStates[SharedNodeIndex]);
+}
+
+bool FFlowSharedNodesState::IsSaveDirty(const UFlowNode& Node) const
+{
+	// state is swapped in while the node executes for this instance
+	if (Node.SharedExecutionState.Get() == this)
+	{
+		return Node.IsSaveDirty();
+	}
+
+	// shared nodes are native and keep no state besides SaveGame properties, so the flag set by MarkSaveDirty is all there is
+	const int32 SharedNodeIndex = ExecutionTable->GetSharedNodeIndex(Node.ExecutionIndex);
+	check(SharedNodeIndex != INDEX_NONE);
+	return NodeStates[SharedNodeIndex].bSaveDirty;
+}
+
+FFlowSharedNodeScope::FFlowSharedNodeScope(UFlowAsset& Instance, UFlowNode& InNode)
+{
+	// node instantiated by the Flow Asset instance or the state already swapped in
+	if (!Instance.SharedNodesState.IsValid() || InNode.GetOuter() == &Instance || InNode.SharedExecutionState == Instance.SharedNodesState)
+	{
+		return;
+	}
+
+	Node = &InNode;
+	PreviousInstance = InNode.SharedExecutionInstance;
+	PreviousState = InNode.SharedExecutionState;
+
+	if (PreviousState.IsValid())
+	{
+		PreviousState->Swap(InNode);
+	}
+	Instance.SharedNodesState->Swap(InNode);
+
+	InNode.SharedExecutionInstance = &Instance;
+	InNode.SharedExecutionState = Instance.SharedNodesState;
+}
+
+FFlowSharedNodeScope::~FFlowSharedNodeScope()
+{
+	if (Node == nullptr)
+	{
+		return;
+	}
+
+	// instance might have been deinitialized within the scope, the state is kept alive by the node
+	Node->SharedExecutionState->Swap(*Node);
+	if (PreviousState.IsValid())
+	{
+		PreviousState->Swap(*Node);
+	}
+
+	Node->SharedExecutionInstance = PreviousInstance;
+	Node->SharedExecutionState = PreviousState;
+}
+
 void UFlowAsset::InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlowAsset& InTemplateAsset)
 {
 	check(!IsInstanceInitialized());
@@ -904,11 +1044,39 @@ void UFlowAsset::InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlow
 	Owner = InOwner;
 	TemplateAsset = &InTemplateAsset;
 
+	ExecutionTable = InTemplateAsset.GetCompiledExecutionTable();
+	IndexedNodes.SetNumZeroed(ExecutionTable->GetNodesNum());
+	ActiveNodeFlags.Init(false, ExecutionTable->GetNodesNum());
+	ActiveNodePositions.Init(INDEX_NONE, ExecutionTable->GetNodesNum());
+	RecordedNodeFlags.Init(false, ExecutionTable->GetNodesNum());
+
+	// pooled instance already holds node instances, reset by ResetInstance
+	const bool bReuseNodeInstances = bPooledInstance;
+	bPooledInstance = false;
+
 	for (TPair<FGuid, TObjectPtr<UFlowNode>>& Node : Nodes)
 	{
-		UFlowNode* NewNodeInstance = NewObject<UFlowNode>(this, Node.Value->GetClass(), NAME_None, RF_Transient, Node.Value, false, nullptr);
+		const int32 NodeIndex = ExecutionTable->FindNodeIndex(Node.Key);
+		if (ExecutionTable->GetSharedNodeIndex(NodeIndex) != INDEX_NONE)
+		{
+			// node executes against the template, with state kept in SharedNodesState
+			UFlowNode* TemplateNode = InTemplateAsset.Nodes.FindChecked(Node.Key);
+			TemplateNode->ExecutionIndex = NodeIndex;
+			IndexedNodes[NodeIndex] = TemplateNode;
+			Node.Value = TemplateNode;
+			continue;
+		}
+
+		const bool bReuseNodeInstance = bReuseNodeInstances && Node.Value->GetOuter() == this;
+		UFlowNode* NewNodeInstance = bReuseNodeInstance ? Node.Value.Get() : NewObject<UFlowNode>(this, Node.Value->GetClass(), NAME_None, RF_Transient, Node.Value, false, nullptr);
 		Node.Value = NewNodeInstance;
 
+		NewNodeInstance->ExecutionIndex = NodeIndex;
+		if (NodeIndex != INDEX_NONE)
+		{
+			IndexedNodes[NodeIndex] = NewNodeInstance;
+		}
+
 		if (UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(NewNodeInstance))
 		{
 			if (!CustomInput->EventName.IsNone())
@@ -919,6 +1087,11 @@ void UFlowAsset::InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlow
 
 		NewNodeInstance->InitializeInstance();
 	}
+
+	if (ExecutionTable->GetSharedNodesNum() > 0)
+	{
+		SharedNodesState = MakeShared<FFlowSharedNodesState>(ExecutionTable.ToSharedRef(), IndexedNodes);
+	}
 }
 
 void UFlowAsset::DeinitializeInstance()
@@ -927,22 +1100,77 @@ void UFlowAsset::DeinitializeInstance()
 	{
 		for (const TPair<FGuid, UFlowNode*>& Node : ObjectPtrDecay(Nodes))
 		{
-			if (IsValid(Node.Value))
+			// shared template nodes aren't initialized per instance
+			if (IsValid(Node.Value) && Node.Value->GetOuter() == this)
 			{
 				Node.Value->DeinitializeInstance();
 			}
 		}
+		SharedNodesState.Reset();
+
+		FLOW_TRACE_INSTANCE_REMOVED(*this);
 
 		const int32 ActiveInstancesLeft = TemplateAsset->RemoveInstance(this);
-		if (ActiveInstancesLeft == 0 && GetFlowSubsystem())
+		if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 		{
-			GetFlowSubsystem()->RemoveInstancedTemplate(TemplateAsset);
+			if (ActiveInstancesLeft == 0)
+			{
+				FlowSubsystem->RemoveInstancedTemplate(TemplateAsset);
+			}
+
+			FlowSubsystem->TryPoolInstance(TemplateAsset, *this);
 		}
 
 		TemplateAsset = nullptr;
 	}
 }
 
+bool UFlowAsset::CanBePooled() const
+{
+	for (const TPair<FGuid, TObjectPtr<UFlowNode>>& Node : Nodes)
+	{
+		if (!IsValid(Node.Value) || (Node.Value->GetOuter() == this && !Node.Value->CanBePooled()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UFlowAsset::ResetInstance(const UFlowAsset& Template)
+{
+	// nodes are reset first, as they might need the Owner to find the world
+	for (TPair<FGuid, TObjectPtr<UFlowNode>>& Node : Nodes)
+	{
+		const UFlowNode* TemplateNode = Template.Nodes.FindRef(Node.Key);
+		if (TemplateNode && Node.Value != TemplateNode)
+		{
+			Node.Value->ResetInstance(*TemplateNode);
+		}
+	}
+	RecordedNodes.Empty();
+
+	Owner.Reset();
+	NodeOwningThisAssetInstance.Reset();
+	ActiveSubGraphs.Empty();
+	CustomInputNodes.Empty();
+	PreloadedNodes.Empty();
+	FinishPolicy = EFlowFinishPolicy::Keep;
+
+	CachedSaveRecord = FFlowAssetSaveData();
+	bSaveDirty = true;
+
+	// properties declared by UFlowAsset are either template settings or runtime state reset above
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		if (It->GetOwnerClass() != UFlowAsset::StaticClass() && !It->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference))
+		{
+			It->CopyCompleteValue_InContainer(this, &Template);
+		}
+	}
+}
+
 void UFlowAsset::PreStartFlow()
 {
 	ResetNodes();
@@ -966,16 +1194,18 @@ void UFlowAsset::PreStartFlow()
 void UFlowAsset::StartFlow(IFlowDataPinValueSupplierInterface* DataPinValueSupplier)
 {
 	PreStartFlow();
+	FLOW_TRACE_INSTANCE_STARTED(*this);
 
 	if (UFlowNode* ConnectedEntryNode = GetDefaultEntryNode())
 	{
-		RecordedNodes.Add(ConnectedEntryNode);
+		RecordNode(ConnectedEntryNode);
 
 		if (IFlowNodeWithExternalDataPinSupplierInterface* ExternalPinSuppliedNode = Cast<IFlowNodeWithExternalDataPinSupplierInterface>(ConnectedEntryNode))
 		{
 			ExternalPinSuppliedNode->SetDataPinValueSupplier(DataPinValueSupplier);
 		}
 
+		const FFlowSharedNodeScope SharedNodeScope(*this, *ConnectedEntryNode);
 		ConnectedEntryNode->TriggerFirstOutput(true);
 	}
 }
@@ -983,20 +1213,29 @@ void UFlowAsset::StartFlow(IFlowDataPinValueSupplierInterface* DataPinValueSuppl
 void UFlowAsset::FinishFlow(const EFlowFinishPolicy InFinishPolicy, const bool bRemoveInstance /*= true*/)
 {
 	FinishPolicy = InFinishPolicy;
+	FLOW_TRACE_INSTANCE_FINISHED(*this);
 
 	// end execution of this asset and all of its nodes
 	for (UFlowNode* Node : ActiveNodes)
 	{
+		const FFlowSharedNodeScope SharedNodeScope(*this, *Node);
 		Node->Deactivate();
 	}
-	ActiveNodes.Empty();
+	ClearActiveNodes();
+
+	// signals queued for nodes that have been just deactivated
+	PendingSignals.Empty();
+	ExternalSignals.Empty();
+	ExternalSignalsHead = 0;
 
 	// flush preloaded content
 	for (UFlowNode* PreloadedNode : PreloadedNodes)
 	{
+		const FFlowSharedNodeScope SharedNodeScope(*this, *PreloadedNode);
 		PreloadedNode->TriggerFlush();
 	}
 	PreloadedNodes.Empty();
+	FlushPrefetchedContent();
 
 	// provides option to finish game-specific logic prior to removing asset instance 
 	if (bRemoveInstance)
@@ -1045,7 +1284,7 @@ void UFlowAsset::TriggerCustomInput(const FName& EventName, IFlowDataPinValueSup
 	{
 		if (CustomInputNode->EventName == EventName)
 		{
-			RecordedNodes.Add(CustomInputNode);
+			RecordNode(CustomInputNode);
 
 			// NOTE (gtaylor) Custom Input nodes cannot currently add data pins (like Start or DefineProperties nodes can)
 			// but we may want to allow them to source parameters, so I am providing the subgraph node as the 
@@ -1080,23 +1319,184 @@ void UFlowAsset::TriggerCustomOutput(const FName& EventName)
 
 void UFlowAsset::TriggerInput(const FGuid& NodeGuid, const FName& PinName, const FConnectedPin& FromPin)
 {
-	if (UFlowNode* Node = Nodes.FindRef(NodeGuid))
+	const int32 NodeIndex = ExecutionTable.IsValid() ? ExecutionTable->FindNodeIndex(NodeGuid) : INDEX_NONE;
+	if (NodeIndex != INDEX_NONE && IndexedNodes[NodeIndex])
 	{
-		if (!ActiveNodes.Contains(Node))
+		const int32 PinIndex = IndexedNodes[NodeIndex]->InputPins.IndexOfByKey(PinName);
+		if (PinIndex == INDEX_NONE)
 		{
-			ActiveNodes.Add(Node);
-			RecordedNodes.Add(Node);
+#if !UE_BUILD_SHIPPING
+			IndexedNodes[NodeIndex]->LogError(FString::Printf(TEXT("Input Pin name %s invalid"), *PinName.ToString()));
+#endif
+			return;
 		}
 
-		Node->TriggerInput(PinName);
+		TriggerInputByIndex(NodeIndex, PinIndex, FromPin);
+	}
+}
+
+void UFlowAsset::TriggerInputByIndex(const int32 NodeIndex, const int32 PinIndex, const FConnectedPin& FromPin)
+{
+	if (UFlowNode* Node = IndexedNodes[NodeIndex])
+	{
+		if (!ActiveNodeFlags[NodeIndex])
+		{
+			AddActiveNode(Node);
+			RecordNode(Node);
+		}
+
+		const FFlowSharedNodeScope SharedNodeScope(*this, *Node);
+		Node->TriggerInputByIndex(PinIndex);
+	}
+}
+
+void UFlowAsset::PropagateOutput(const UFlowNode& FromNode, const int32 OutputPinIndex)
+{
+	const FFlowExecutionEdge* Edge = ExecutionTable.IsValid() ? ExecutionTable->FindOutputEdge(FromNode.ExecutionIndex, OutputPinIndex) : nullptr;
+	if (Edge == nullptr || Edge->NodeIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const FName& OutputPinName = FromNode.OutputPins[OutputPinIndex].PinName;
+	if (Edge->PinIndex == INDEX_NONE)
+	{
+		// connection leads to the pin missing on the connected node, i.e. node definition changed after saving the asset
+#if !UE_BUILD_SHIPPING
+		if (const UFlowNode* ToNode = IndexedNodes[Edge->NodeIndex])
+		{
+			ToNode->LogError(FString::Printf(TEXT("Input Pin name %s invalid, connected from %s output %s"),
+				*FromNode.GetConnection(OutputPinName).PinName.ToString(), *FromNode.GetName(), *OutputPinName.ToString()));
+		}
+#endif
+		return;
+	}
+
+	PropagateSignal(Edge->NodeIndex, Edge->PinIndex, FConnectedPin(FromNode.GetGuid(), OutputPinName));
+}
+
+void UFlowAsset::PropagateSignal(const int32 NodeIndex, const int32 PinIndex, const FConnectedPin& FromPin)
+{
+	if (SignalPropagation == EFlowSignalPropagation::Recursive)
+	{
+		// recursive signals can't be deferred, but the time spent on them still counts into the frame budget
+		UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+		if (FlowSubsystem)
+		{
+			FlowSubsystem->BeginSignalExecution();
+		}
+
+		TriggerInputByIndex(NodeIndex, PinIndex, FromPin);
+
+		if (FlowSubsystem)
+		{
+			FlowSubsystem->EndSignalExecution();
+		}
+		return;
+	}
+
+	if (bExecutingPendingSignals || GetPendingSignalsNum() == 0)
+	{
+		PendingSignals.Emplace(NodeIndex, PinIndex, FromPin);
+	}
+	else
+	{
+		// signal triggered by an external event, while some signals were deferred to the next frame
+		// it waits for signals triggered earlier, so it doesn't overtake them
+		ExternalSignals.Emplace(NodeIndex, PinIndex, FromPin);
+	}
+
+	ExecutePendingSignals();
+}
+
+void UFlowAsset::ExecuteScheduledSignals()
+{
+	// executing timer still exists, invalidate it so reaching the budget again would schedule a new one
+	PendingSignalsTimerHandle.Invalidate();
+
+	ExecutePendingSignals();
+}
+
+void UFlowAsset::ExecutePendingSignals()
+{
+	// signals triggered by the currently executed node will be executed by the loop below
+	if (bExecutingPendingSignals)
+	{
+		return;
+	}
+
+	TGuardValue<bool> ExecutionGuard(bExecutingPendingSignals, true);
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+
+	while (GetPendingSignalsNum() > 0)
+	{
+		if (FlowSubsystem && !FlowSubsystem->HasSignalBudget())
+		{
+			FlowSubsystem->DeferSignals(this);
+			return;
+		}
+
+		if (SignalsPerFrameBudget > 0)
+		{
+			if (SignalBudgetFrame != GFrameCounter)
+			{
+				SignalBudgetFrame = GFrameCounter;
+				SignalsExecutedThisFrame = 0;
+			}
+
+			if (SignalsExecutedThisFrame >= SignalsPerFrameBudget)
+			{
+				UWorld* World = GetWorld();
+				if (World && !World->GetTimerManager().TimerExists(PendingSignalsTimerHandle))
+				{
+					PendingSignalsTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UFlowAsset::ExecuteScheduledSignals);
+				}
+				return;
+			}
+
+			SignalsExecutedThisFrame++;
+		}
+
+		if (PendingSignals.Num() == 0)
+		{
+			PendingSignals.Add(ExternalSignals[ExternalSignalsHead++]);
+			if (ExternalSignalsHead == ExternalSignals.Num())
+			{
+				ExternalSignals.Reset();
+				ExternalSignalsHead = 0;
+			}
+		}
+
+		const FFlowPendingSignal Signal = PendingSignals.Pop(EAllowShrinking::No);
+		const int32 FirstTriggeredIndex = PendingSignals.Num();
+
+		if (FlowSubsystem)
+		{
+			FlowSubsystem->BeginSignalExecution();
+		}
+
+		TriggerInputByIndex(Signal.NodeIndex, Signal.PinIndex, Signal.FromPin);
+
+		if (FlowSubsystem)
+		{
+			FlowSubsystem->EndSignalExecution();
+		}
+
+		// node pushed its outputs in the order of triggering, reverse them so the first triggered output is executed first
+		// queue might have been emptied in the meantime, i.e. if the graph finished
+		const int32 TriggeredNum = PendingSignals.Num() - FirstTriggeredIndex;
+		if (TriggeredNum > 1)
+		{
+			Algo::Reverse(MakeArrayView(PendingSignals).Slice(FirstTriggeredIndex, TriggeredNum));
+		}
 	}
 }
 
 void UFlowAsset::FinishNode(UFlowNode* Node)
 {
-	if (ActiveNodes.Contains(Node))
+	if (IsNodeActive(Node))
 	{
-		ActiveNodes.Remove(Node);
+		RemoveActiveNode(Node);
 
 		// if graph reached Finish and this asset instance was created by SubGraph node
 		if (Node->CanFinishGraph())
@@ -1129,10 +1529,276 @@ void UFlowAsset::ResetNodes()
 {
 	for (UFlowNode* Node : RecordedNodes)
 	{
+		const FFlowSharedNodeScope SharedNodeScope(*this, *Node);
 		Node->ResetRecords();
 	}
 
 	RecordedNodes.Empty();
+	RecordedNodeFlags.SetRange(0, RecordedNodeFlags.Num(), false);
+}
+
+void UFlowAsset::AddActiveNode(UFlowNode* Node)
+{
+	if (ActiveNodeFlags.IsValidIndex(Node->ExecutionIndex))
+	{
+		ActiveNodeFlags[Node->ExecutionIndex] = true;
+		ActiveNodePositions[Node->ExecutionIndex] = ActiveNodes.Add(Node);
+		bSaveDirty = true;
+
+		const UFlowSettings* Settings = UFlowSettings::Get();
+		if (Settings->bAsyncLoadSubGraphs)
+		{
+			PrefetchSubGraphs(*Node);
+		}
+
+		if (Settings->bPrefetchContent)
+		{
+			ScheduleContentPrefetch();
+		}
+	}
+}
+
+void UFlowAsset::RemoveActiveNode(const UFlowNode* Node)
+{
+	if (ActiveNodeFlags.IsValidIndex(Node->ExecutionIndex))
+	{
+		ActiveNodeFlags[Node->ExecutionIndex] = false;
+
+		// keep the activation order of other nodes, so positions of the following nodes are updated
+		const int32 Position = ActiveNodePositions[Node->ExecutionIndex];
+		ActiveNodePositions[Node->ExecutionIndex] = INDEX_NONE;
+		ActiveNodes.RemoveAt(Position, 1, EAllowShrinking::No);
+
+		for (int32 i = Position; i < ActiveNodes.Num(); i++)
+		{
+			ActiveNodePositions[ActiveNodes[i]->ExecutionIndex] = i;
+		}
+		bSaveDirty = true;
+
+		if (UFlowSettings::Get()->bPrefetchContent)
+		{
+			ScheduleContentPrefetch();
+		}
+	}
+}
+
+void UFlowAsset::PrefetchSubGraphs(const UFlowNode& FromNode) const
+{
+	const int32 PrefetchDepth = UFlowSettings::Get()->SubGraphPrefetchDepth;
+	if (PrefetchDepth <= 0)
+	{
+		return;
+	}
+
+	VisitNodesAhead({FromNode.ExecutionIndex}, PrefetchDepth, MAX_int32, [](UFlowNode& Node)
+	{
+		if (UFlowNode_SubGraph* SubGraphNode = Cast<UFlowNode_SubGraph>(&Node))
+		{
+			SubGraphNode->RequestAssetLoad();
+		}
+	});
+}
+
+void UFlowAsset::VisitNodesAhead(TConstArrayView<int32> FromNodeIndices, const int32 MaxDepth, const int32 MaxNodes, TFunctionRef<void(UFlowNode&)> Visitor) const
+{
+	if (!ExecutionTable.IsValid())
+	{
+		return;
+	}
+
+	TBitArray<> VisitedNodes(false, ExecutionTable->GetNodesNum());
+	FlowArray::TInlineArray<int32, 16> Frontier;
+	FlowArray::TInlineArray<int32, 16> NextFrontier;
+
+	for (const int32 NodeIndex : FromNodeIndices)
+	{
+		if (VisitedNodes.IsValidIndex(NodeIndex) && !VisitedNodes[NodeIndex])
+		{
+			VisitedNodes[NodeIndex] = true;
+			Frontier.Add(NodeIndex);
+		}
+	}
+
+	int32 VisitedNum = 0;
+	for (int32 Depth = 0; Depth < MaxDepth && Frontier.Num() > 0; Depth++)
+	{
+		NextFrontier.Reset();
+
+		for (const int32 NodeIndex : Frontier)
+		{
+			for (const FFlowExecutionEdge& Edge : ExecutionTable->GetOutputEdges(NodeIndex))
+			{
+				if (Edge.IsConnected() && !VisitedNodes[Edge.NodeIndex])
+				{
+					VisitedNodes[Edge.NodeIndex] = true;
+					NextFrontier.Add(Edge.NodeIndex);
+
+					if (UFlowNode* Node = IndexedNodes[Edge.NodeIndex])
+					{
+						Visitor(*Node);
+					}
+
+					if (++VisitedNum >= MaxNodes)
+					{
+						return;
+					}
+				}
+			}
+		}
+
+		Swap(Frontier, NextFrontier);
+	}
+}
+
+void UFlowAsset::ScheduleContentPrefetch()
+{
+	if (bContentPrefetchScheduled)
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		bContentPrefetchScheduled = true;
+		World->GetTimerManager().SetTimerForNextTick(this, &UFlowAsset::UpdateContentPrefetch);
+	}
+	else
+	{
+		UpdateContentPrefetch();
+	}
+}
+
+void UFlowAsset::UpdateContentPrefetch()
+{
+	bContentPrefetchScheduled = false;
+
+	const UFlowSettings* Settings = UFlowSettings::Get();
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (!Settings->bPrefetchContent || !IsInstanceInitialized() || FlowSubsystem == nullptr)
+	{
+		FlushPrefetchedContent();
+		return;
+	}
+
+	FlowArray::TInlineArray<int32, 16> ActiveNodeIndices;
+	for (const UFlowNode* Node : ActiveNodes)
+	{
+		ActiveNodeIndices.Add(Node->ExecutionIndex);
+	}
+
+	// nearest nodes first, so the memory budget is spent on content needed soonest
+	TArray<FSoftObjectPath> WantedPaths;
+	VisitNodesAhead(ActiveNodeIndices, Settings->ContentPrefetchDepth, Settings->ContentPrefetchNodeBudget, [&WantedPaths](UFlowNode& Node)
+	{
+		Node.GatherPrefetchContent(WantedPaths);
+	});
+
+	// release content no active node leads to anymore
+	const TSet<FSoftObjectPath> WantedPathsSet(WantedPaths);
+	for (auto It = PrefetchedContent.CreateIterator(); It; ++It)
+	{
+		if (!WantedPathsSet.Contains(It.Key()))
+		{
+			if (It.Value().Handle.IsValid())
+			{
+				It.Value().Handle->ReleaseHandle();
+			}
+			FlowSubsystem->ReleasePrefetchMemory(It.Value().ReservedBytes);
+			It.RemoveCurrent();
+		}
+	}
+
+	const bool bMemoryBudgetSet = Settings->ContentPrefetchMemoryBudget > 0;
+	for (const FSoftObjectPath& Path : WantedPaths)
+	{
+		if (PrefetchedContent.Contains(Path))
+		{
+			continue;
+		}
+
+		// size of content is known only after it's loaded, so loads still in flight can exceed the budget
+		if (!FlowSubsystem->HasPrefetchMemoryBudget())
+		{
+			break;
+		}
+
+		// content already loaded by someone else doesn't count against the budget
+		const bool bMeasureContent = bMemoryBudgetSet && Path.ResolveObject() == nullptr;
+
+		FPrefetchedContent& Content = PrefetchedContent.Add(Path);
+		Content.Handle = FlowSubsystem->GetStreamableManager().RequestAsyncLoad(Path,
+			bMeasureContent ? FStreamableDelegate::CreateUObject(this, &UFlowAsset::OnPrefetchedContentLoaded, Path) : FStreamableDelegate());
+	}
+}
+
+void UFlowAsset::OnPrefetchedContentLoaded(FSoftObjectPath Path)
+{
+	// content might have been released, or requested again, before this load completed
+	FPrefetchedContent* Content = PrefetchedContent.Find(Path);
+	if (Content == nullptr || Content->ReservedBytes > 0 || !Content->Handle.IsValid() || !Content->Handle->HasLoadCompleted())
+	{
+		return;
+	}
+
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (FlowSubsystem == nullptr)
+	{
+		return;
+	}
+
+	TArray<UObject*> LoadedAssets;
+	Content->Handle->GetLoadedAssets(LoadedAssets);
+
+	for (const UObject* LoadedAsset : LoadedAssets)
+	{
+		if (LoadedAsset)
+		{
+			Content->ReservedBytes += FMath::Max<int64>(LoadedAsset->GetResourceSizeBytes(EResourceSizeMode::Exclusive), 0);
+		}
+	}
+
+	FlowSubsystem->ReservePrefetchMemory(Content->ReservedBytes);
+}
+
+void UFlowAsset::FlushPrefetchedContent()
+{
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+
+	for (TPair<FSoftObjectPath, FPrefetchedContent>& Content : PrefetchedContent)
+	{
+		if (Content.Value.Handle.IsValid())
+		{
+			Content.Value.Handle->ReleaseHandle();
+		}
+
+		if (FlowSubsystem)
+		{
+			FlowSubsystem->ReleasePrefetchMemory(Content.Value.ReservedBytes);
+		}
+	}
+
+	PrefetchedContent.Empty();
+}
+
+void UFlowAsset::ClearActiveNodes()
+{
+	ActiveNodes.Empty();
+	ActiveNodeFlags.SetRange(0, ActiveNodeFlags.Num(), false);
+	bSaveDirty = true;
+
+	for (int32& Position : ActiveNodePositions)
+	{
+		Position = INDEX_NONE;
+	}
+}
+
+void UFlowAsset::RecordNode(UFlowNode* Node)
+{
+	if (RecordedNodeFlags.IsValidIndex(Node->ExecutionIndex) && !RecordedNodeFlags[Node->ExecutionIndex])
+	{
+		RecordedNodeFlags[Node->ExecutionIndex] = true;
+		RecordedNodes.Add(Node);
+	}
 }
 
 UFlowSubsystem* UFlowAsset::GetFlowSubsystem() const
@@ -1157,54 +1823,84 @@ UFlowAsset* UFlowAsset::GetParentInstance() const
 
 FFlowAssetSaveData UFlowAsset::SaveInstance(TArray<FFlowAssetSaveData>& SavedFlowInstances)
 {
-	FFlowAssetSaveData AssetRecord;
-	AssetRecord.WorldName = IsBoundToWorld() ? GetWorld()->GetName() : FString();
-	AssetRecord.InstanceName = GetName();
+	CaptureInstance(SavedFlowInstances);
+	return SavedFlowInstances.Last();
+}
 
-	// opportunity to collect data before serializing asset
-	OnSave();
+void UFlowAsset::CaptureInstance(TArray<FFlowAssetSaveData>& SavedFlowInstances)
+{
+	const TArray<TObjectPtr<UFlowNode>>& SaveOrderNodes = GetNodesInSaveOrder();
 
-	// iterate nodes
-	TArray<UFlowNode*> NodesInExecutionOrder;
-	GetNodesInExecutionOrder<UFlowNode>(GetDefaultEntryNode(), NodesInExecutionOrder);
-	for (UFlowNode* Node : NodesInExecutionOrder)
+	// iterate SubGraphs, even if this instance didn't change since the previous save, its SubGraphs might have changed
+	for (UFlowNode* Node : SaveOrderNodes)
 	{
-		if (Node && Node->ActivationState == EFlowNodeState::Active)
+		// SubGraph nodes are never shared, so their state can be read directly
+		if (UFlowNode_SubGraph* SubGraphNode = Cast<UFlowNode_SubGraph>(Node))
 		{
-			// iterate SubGraphs
-			if (UFlowNode_SubGraph* SubGraphNode = Cast<UFlowNode_SubGraph>(Node))
+			if (SubGraphNode->ActivationState == EFlowNodeState::Active)
 			{
 				const TWeakObjectPtr<UFlowAsset> SubFlowInstance = GetFlowInstance(SubGraphNode);
 				if (SubFlowInstance.IsValid())
 				{
-					const FFlowAssetSaveData SubAssetRecord = SubFlowInstance->SaveInstance(SavedFlowInstances);
-					SubGraphNode->SavedAssetInstanceName = SubAssetRecord.InstanceName;
+					SubFlowInstance->CaptureInstance(SavedFlowInstances);
+
+					const FString SubFlowInstanceName = SubFlowInstance->GetName();
+					if (SubGraphNode->SavedAssetInstanceName != SubFlowInstanceName)
+					{
+						SubGraphNode->SavedAssetInstanceName = SubFlowInstanceName;
+						SubGraphNode->MarkSaveDirty();
+					}
 				}
 			}
+		}
+	}
 
-			FFlowNodeSaveData NodeRecord;
-			Node->SaveInstance(NodeRecord);
+	const bool bIncrementalSave = UFlowSettings::Get()->bIncrementalSaveData;
+	if (bIncrementalSave && !IsSaveDirty())
+	{
+		// instance might have been moved to another world since the previous save
+		CachedSaveRecord.WorldName = IsBoundToWorld() ? GetWorld()->GetName() : FString();
+		CachedSaveRecord.InstanceName = GetName();
+
+		SavedFlowInstances.Add(CachedSaveRecord);
+		return;
+	}
 
-			AssetRecord.NodeRecords.Emplace(NodeRecord);
+	FFlowAssetSaveData AssetRecord;
+	AssetRecord.WorldName = IsBoundToWorld() ? GetWorld()->GetName() : FString();
+	AssetRecord.InstanceName = GetName();
+
+	// opportunity to collect data before serializing asset
+	OnSave();
+
+	// iterate nodes, unchanged nodes reuse their cached records
+	for (UFlowNode* Node : SaveOrderNodes)
+	{
+		const FFlowSharedNodeScope SharedNodeScope(*this, *Node);
+		if (Node->ActivationState == EFlowNodeState::Active)
+		{
+			FFlowNodeSaveData& NodeRecord = AssetRecord.NodeRecords.AddDefaulted_GetRef();
+			Node->SaveInstance(NodeRecord);
 		}
 	}
 
 	// serialize asset
-	FMemoryWriter MemoryWriter(AssetRecord.AssetData, true);
-	FFlowArchive Ar(MemoryWriter);
-	Serialize(Ar);
+	FlowSave::SaveObject(*this, AssetRecord.AssetData);
 
-	// write archive to SaveGame
-	SavedFlowInstances.Emplace(AssetRecord);
+	if (bIncrementalSave)
+	{
+		CachedSaveRecord = AssetRecord;
+		bSaveDirty = false;
+	}
 
-	return AssetRecord;
+	// write archive to SaveGame
+	SavedFlowInstances.Add(MoveTemp(AssetRecord));
 }
 
 void UFlowAsset::LoadInstance(const FFlowAssetSaveData& AssetRecord)
 {
-	FMemoryReader MemoryReader(AssetRecord.AssetData, true);
-	FFlowArchive Ar(MemoryReader);
-	Serialize(Ar);
+	FlowSave::LoadObject(*this, AssetRecord.AssetData);
+	bSaveDirty = true;
 
 	PreStartFlow();
 
@@ -1214,6 +1910,7 @@ void UFlowAsset::LoadInstance(const FFlowAssetSaveData& AssetRecord)
 	{
 		if (UFlowNode* Node = Nodes.FindRef(AssetRecord.NodeRecords[i].NodeGuid))
 		{
+			const FFlowSharedNodeScope SharedNodeScope(*this, *Node);
 			Node->LoadInstance(AssetRecord.NodeRecords[i]);
 		}
 	}
@@ -1221,16 +1918,55 @@ void UFlowAsset::LoadInstance(const FFlowAssetSaveData& AssetRecord)
 	OnLoad();
 }
 
+bool UFlowAsset::IsSaveDirty() const
+{
+	if (bSaveDirty || GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UFlowAsset, OnSave)))
+	{
+		return true;
+	}
+
+	for (const UFlowNode* Node : ActiveNodes)
+	{
+		const bool bSharedNode = SharedNodesState.IsValid() && Node->GetOuter() != this;
+		if (bSharedNode ? SharedNodesState->IsSaveDirty(*Node) : Node->IsSaveDirty())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const TArray<TObjectPtr<UFlowNode>>& UFlowAsset::GetNodesInSaveOrder()
+{
+	if (NodesInSaveOrder.IsEmpty())
+	{
+		TArray<UFlowNode*> NodesInExecutionOrder;
+		GetNodesInExecutionOrder<UFlowNode>(GetDefaultEntryNode(), NodesInExecutionOrder);
+
+		NodesInSaveOrder.Reserve(NodesInExecutionOrder.Num());
+		for (UFlowNode* Node : NodesInExecutionOrder)
+		{
+			if (Node)
+			{
+				NodesInSaveOrder.Add(Node);
+			}
+		}
+	}
+
+	return NodesInSaveOrder;
+}
+
 void UFlowAsset::OnActivationStateLoaded(UFlowNode* Node)
 {
 	if (Node->ActivationState != EFlowNodeState::NeverActivated)
 	{
-		RecordedNodes.Emplace(Node);
+		RecordNode(Node);
 	}
 
-	if (Node->ActivationState == EFlowNodeState::Active)
+	if (Node->ActivationState == EFlowNodeState::Active && !IsNodeActive(Node))
 	{
-		ActiveNodes.Emplace(Node);
+		AddActiveNode(Node);
 	}
 }
 
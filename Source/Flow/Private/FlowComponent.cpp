@@ -14,8 +14,6 @@
 #include "Engine/World.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
-#include "Serialization/MemoryReader.h"
-#include "Serialization/MemoryWriter.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowComponent)
 
@@ -113,6 +111,7 @@ void UFlowComponent::AddIdentityTag(const FGameplayTag Tag, const EFlowNetMode N
 	if (IsFlowNetMode(NetMode) && Tag.IsValid() && !IdentityTags.HasTagExact(Tag))
 	{
 		IdentityTags.AddTag(Tag);
+		MarkSaveDirty();
 #if WITH_PUSH_MODEL
 		if (GetNetMode() < NM_Client)
 		{
@@ -148,6 +147,7 @@ void UFlowComponent::AddIdentityTags(FGameplayTagContainer Tags, const EFlowNetM
 
 		if (ValidatedTags.Num() > 0)
 		{
+			MarkSaveDirty();
 #if WITH_PUSH_MODEL
 			if (GetNetMode() < NM_Client)
 			{
@@ -172,6 +172,7 @@ void UFlowComponent::RemoveIdentityTag(const FGameplayTag Tag, const EFlowNetMod
 	if (IsFlowNetMode(NetMode) && Tag.IsValid() && IdentityTags.HasTagExact(Tag))
 	{
 		IdentityTags.RemoveTag(Tag);
+		MarkSaveDirty();
 #if WITH_PUSH_MODEL
 		if (GetNetMode() < NM_Client)
 		{
@@ -207,6 +208,7 @@ void UFlowComponent::RemoveIdentityTags(FGameplayTagContainer Tags, const EFlowN
 
 		if (ValidatedTags.Num() > 0)
 		{
+			MarkSaveDirty();
 #if WITH_PUSH_MODEL
 			if (GetNetMode() < NM_Client)
 			{
@@ -412,9 +414,16 @@ void UFlowComponent::NotifyActor(const FGameplayTag ActorTag, const FGameplayTag
 	{
 		if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 		{
-			for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(ActorTag))
+			// collect components first, as receiving notify might change Identity Tags of components
+			TArray<TWeakObjectPtr<UFlowComponent>, TInlineAllocator<8>> FoundComponents;
+			FlowSubsystem->GetComponents(ActorTag, FoundComponents);
+
+			for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
 			{
-				Component->ReceiveNotify.Broadcast(this, NotifyTag);
+				if (Component.IsValid())
+				{
+					Component->ReceiveNotify.Broadcast(this, NotifyTag);
+				}
 			}
 		}
 
@@ -433,11 +442,18 @@ void UFlowComponent::OnRep_NotifyTagsFromAnotherComponent()
 {
 	if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 	{
+		TArray<TWeakObjectPtr<UFlowComponent>, TInlineAllocator<8>> FoundComponents;
 		for (const FNotifyTagReplication& Notify : NotifyTagsFromAnotherComponent)
 		{
-			for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(Notify.ActorTag))
+			FoundComponents.Reset();
+			FlowSubsystem->GetComponents(Notify.ActorTag, FoundComponents);
+
+			for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
 			{
-				Component->ReceiveNotify.Broadcast(this, Notify.NotifyTag);
+				if (Component.IsValid())
+				{
+					Component->ReceiveNotify.Broadcast(this, Notify.NotifyTag);
+				}
 			}
 		}
 	}
@@ -531,12 +547,12 @@ void UFlowComponent::SaveRootFlow(TArray<FFlowAssetSaveData>& SavedFlowInstances
 {
 	if (UFlowAsset* FlowAssetInstance = GetRootFlowInstance())
 	{
-		const FFlowAssetSaveData AssetRecord = FlowAssetInstance->SaveInstance(SavedFlowInstances);
-		SavedAssetInstanceName = AssetRecord.InstanceName;
+		FlowAssetInstance->CaptureInstance(SavedFlowInstances);
+		SetSavedAssetInstanceName(FlowAssetInstance->GetName());
 		return;
 	}
 
-	SavedAssetInstanceName = FString();
+	SetSavedAssetInstanceName(FString());
 }
 
 void UFlowComponent::LoadRootFlow()
@@ -546,7 +562,7 @@ void UFlowComponent::LoadRootFlow()
 		VerifyIdentityTags();
 
 		GetFlowSubsystem()->LoadRootFlow(this, RootFlow, SavedAssetInstanceName, bAllowMultipleInstances);
-		SavedAssetInstanceName = FString();
+		SetSavedAssetInstanceName(FString());
 	}
 }
 
@@ -556,39 +572,57 @@ FFlowComponentSaveData UFlowComponent::SaveInstance()
 	ComponentRecord.WorldName = GetWorld()->GetName();
 	ComponentRecord.ActorInstanceName = GetOwner()->GetName();
 
+	const bool bIncrementalSave = UFlowSettings::Get()->bIncrementalSaveData;
+	if (bIncrementalSave && !IsSaveDirty())
+	{
+		ComponentRecord.ComponentData = CachedSaveData;
+		return ComponentRecord;
+	}
+
 	// opportunity to collect data before serializing component
 	OnSave();
 
 	// serialize component
-	FMemoryWriter MemoryWriter(ComponentRecord.ComponentData, true);
-	FFlowArchive Ar(MemoryWriter);
-	Serialize(Ar);
+	FlowSave::SaveObject(*this, ComponentRecord.ComponentData);
+
+	if (bIncrementalSave)
+	{
+		CachedSaveData = ComponentRecord.ComponentData;
+		bSaveDirty = false;
+	}
 
 	return ComponentRecord;
 }
 
 bool UFlowComponent::LoadInstance()
 {
-	const UFlowSaveGame* SaveGame = GetFlowSubsystem()->GetLoadedSaveGame();
-	if (SaveGame->FlowComponents.Num() > 0)
+	if (const FFlowComponentSaveData* ComponentRecord = GetFlowSubsystem()->FindSavedComponentRecord(GetWorld()->GetName(), GetOwner()->GetName()))
 	{
-		for (const FFlowComponentSaveData& ComponentRecord : SaveGame->FlowComponents)
-		{
-			if (ComponentRecord.WorldName == GetWorld()->GetName() && ComponentRecord.ActorInstanceName == GetOwner()->GetName())
-			{
-				FMemoryReader MemoryReader(ComponentRecord.ComponentData, true);
-				FFlowArchive Ar(MemoryReader);
-				Serialize(Ar);
+		FlowSave::LoadObject(*this, ComponentRecord->ComponentData);
+		MarkSaveDirty();
 
-				OnLoad();
-				return true;
-			}
-		}
+		OnLoad();
+		return true;
 	}
 
 	return false;
 }
 
+bool UFlowComponent::IsSaveDirty() const
+{
+	// we can't tell what Blueprint collects in OnSave
+	return bSaveDirty || GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UFlowComponent, OnSave));
+}
+
+void UFlowComponent::SetSavedAssetInstanceName(const FString& NewName)
+{
+	if (SavedAssetInstanceName != NewName)
+	{
+		SavedAssetInstanceName = NewName;
+		MarkSaveDirty();
+	}
+}
+
 void UFlowComponent::OnSave_Implementation()
 {
 }
@@ -1,15 +1,18 @@
 // Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
 
 #include "FlowModule.h"
+#include "Types/FlowPinPropertyCache.h"
 
 #include "Modules/ModuleManager.h"
 
 void FFlowModule::StartupModule()
 {
+	FFlowPinPropertyCache::RegisterDelegates();
 }
 
 void FFlowModule::ShutdownModule()
 {
+	FFlowPinPropertyCache::UnregisterDelegates();
 }
 
 IMPLEMENT_MODULE(FFlowModule, Flow)
@@ -0,0 +1,383 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowSave.h"
+#include "FlowLogChannels.h"
+#include "FlowSettings.h"
+
+#include "Misc/Compression.h"
+#include "Serialization/ArchiveUObject.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectGlobals.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowSave)
+
+namespace FlowSave
+{
+	// Legacy records start with the length of the first property name, so it can't be mistaken for this value
+	static constexpr uint32 CompactRecordMagic = 0x574F4C46;
+
+	enum class ECompactRecordVersion : uint8
+	{
+		Initial = 1,
+
+		// -----<new versions can be added above this line>-----
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	static constexpr uint8 CompactRecordFlag_Compressed = 1 << 0;
+
+	static const FName CompressionFormat = NAME_Oodle;
+
+	// Upper bound for the decompressed size read from a record, so corrupted data can't request a huge allocation
+	static constexpr int32 MaxUncompressedRecordSize = 64 * 1024 * 1024;
+
+	bool IsCompactRecord(const TArray<uint8>& RecordData)
+	{
+		if (RecordData.Num() < sizeof(uint32))
+		{
+			return false;
+		}
+
+		uint32 Magic = 0;
+		FMemory::Memcpy(&Magic, RecordData.GetData(), sizeof(uint32));
+		return Magic == CompactRecordMagic;
+	}
+
+	// Payload layout: tables offset, serialized object, tables
+	// Tables are written last, as they are filled while serializing the object
+	void WritePayload(UObject& Object, TArray<uint8>& OutData)
+	{
+		FMemoryWriter Writer(OutData, true);
+		Writer.Seek(OutData.Num());
+
+		const int64 TablesOffsetPosition = Writer.Tell();
+		int32 TablesOffset = 0;
+		Writer << TablesOffset;
+
+		FFlowSaveRecordTables Tables;
+		{
+			FFlowCompactArchive Ar(Writer, Tables);
+			Object.Serialize(Ar);
+		}
+
+		TablesOffset = IntCastChecked<int32>(Writer.Tell() - TablesOffsetPosition);
+		Tables.Serialize(Writer);
+
+		Writer.Seek(TablesOffsetPosition);
+		Writer << TablesOffset;
+	}
+
+	void ReadPayload(UObject& Object, const TArrayView<const uint8> PayloadData)
+	{
+		FMemoryReaderView Reader(PayloadData, true);
+
+		int32 TablesOffset = 0;
+		Reader << TablesOffset;
+		const int64 ObjectPosition = Reader.Tell();
+
+		if (Reader.IsError() || TablesOffset < ObjectPosition || TablesOffset > PayloadData.Num())
+		{
+			UE_LOG(LogFlow, Error, TEXT("SaveGame record of %s is corrupted, tables offset %d is out of the record size %d"), *Object.GetPathName(), TablesOffset, PayloadData.Num());
+			return;
+		}
+
+		FFlowSaveRecordTables Tables;
+		Reader.Seek(TablesOffset);
+		Tables.Serialize(Reader);
+		if (Reader.IsError())
+		{
+			UE_LOG(LogFlow, Error, TEXT("SaveGame record of %s is corrupted, failed to read its tables"), *Object.GetPathName());
+			return;
+		}
+		Reader.Seek(ObjectPosition);
+
+		FFlowCompactArchive Ar(Reader, Tables);
+		Object.Serialize(Ar);
+	}
+
+	void SaveObject(UObject& Object, TArray<uint8>& OutRecordData)
+	{
+		OutRecordData.Reset();
+
+		if (!UFlowSettings::Get()->bCompactSaveData)
+		{
+			FMemoryWriter MemoryWriter(OutRecordData, true);
+			FFlowArchive Ar(MemoryWriter);
+			Object.Serialize(Ar);
+			return;
+		}
+
+		{
+			uint32 Magic = CompactRecordMagic;
+			uint8 Version = static_cast<uint8>(ECompactRecordVersion::LatestVersion);
+			uint8 Flags = 0;
+
+			FMemoryWriter Writer(OutRecordData, true);
+			Writer << Magic << Version << Flags;
+		}
+		WritePayload(Object, OutRecordData);
+	}
+
+	void EncodeRecord(TArray<uint8>& InOutRecordData, const int32 CompressionThreshold)
+	{
+		if (!IsCompactRecord(InOutRecordData))
+		{
+			return;
+		}
+
+		FMemoryReader Reader(InOutRecordData, true);
+		uint32 Magic = 0;
+		uint8 Version = 0;
+		uint8 Flags = 0;
+		Reader << Magic << Version << Flags;
+
+		const int32 PayloadPosition = IntCastChecked<int32>(Reader.Tell());
+		int32 UncompressedSize = InOutRecordData.Num() - PayloadPosition;
+		if ((Flags & CompactRecordFlag_Compressed) || UncompressedSize <= CompressionThreshold)
+		{
+			return;
+		}
+
+		TArray<uint8> CompressedData;
+		int32 CompressedSize = FCompression::CompressMemoryBound(CompressionFormat, UncompressedSize);
+		CompressedData.SetNumUninitialized(CompressedSize);
+
+		// compression might not pay off
+		if (!FCompression::CompressMemory(CompressionFormat, CompressedData.GetData(), CompressedSize, InOutRecordData.GetData() + PayloadPosition, UncompressedSize)
+			|| CompressedSize >= UncompressedSize)
+		{
+			return;
+		}
+
+		Flags |= CompactRecordFlag_Compressed;
+
+		TArray<uint8> EncodedData;
+		FMemoryWriter Writer(EncodedData, true);
+		Writer << Magic << Version << Flags << UncompressedSize;
+		Writer.Serialize(CompressedData.GetData(), CompressedSize);
+
+		InOutRecordData = MoveTemp(EncodedData);
+	}
+
+	void EncodeSnapshot(FFlowSaveSnapshot& Snapshot)
+	{
+		if (Snapshot.bCompressRecords)
+		{
+			for (FFlowAssetSaveData& AssetRecord : Snapshot.FlowInstances)
+			{
+				EncodeRecord(AssetRecord.AssetData, Snapshot.CompressionThreshold);
+
+				for (FFlowNodeSaveData& NodeRecord : AssetRecord.NodeRecords)
+				{
+					EncodeRecord(NodeRecord.NodeData, Snapshot.CompressionThreshold);
+				}
+			}
+
+			for (FFlowComponentSaveData& ComponentRecord : Snapshot.FlowComponents)
+			{
+				EncodeRecord(ComponentRecord.ComponentData, Snapshot.CompressionThreshold);
+			}
+		}
+
+		// we only replace data for the captured world + global Flow Graph instances (i.e. not bound to any world if created by UGameInstanceSubsystem)
+		// we keep data bound to other worlds
+		if (Snapshot.WorldName.IsSet())
+		{
+			const FString& WorldName = Snapshot.WorldName.GetValue();
+
+			Snapshot.PreviousFlowInstances.RemoveAll([&WorldName](const FFlowAssetSaveData& Record)
+			{
+				return Record.WorldName.IsEmpty() || Record.WorldName == WorldName;
+			});
+
+			Snapshot.PreviousFlowComponents.RemoveAll([&WorldName](const FFlowComponentSaveData& Record)
+			{
+				return Record.WorldName.IsEmpty() || Record.WorldName == WorldName;
+			});
+		}
+
+		Snapshot.PreviousFlowInstances.Append(MoveTemp(Snapshot.FlowInstances));
+		Snapshot.FlowInstances = MoveTemp(Snapshot.PreviousFlowInstances);
+
+		Snapshot.PreviousFlowComponents.Append(MoveTemp(Snapshot.FlowComponents));
+		Snapshot.FlowComponents = MoveTemp(Snapshot.PreviousFlowComponents);
+	}
+
+	void LoadObject(UObject& Object, const TArray<uint8>& RecordData)
+	{
+		if (!IsCompactRecord(RecordData))
+		{
+			FMemoryReader MemoryReader(RecordData, true);
+			FFlowArchive Ar(MemoryReader);
+			Object.Serialize(Ar);
+			return;
+		}
+
+		FMemoryReader Reader(RecordData, true);
+		uint32 Magic = 0;
+		uint8 Version = 0;
+		uint8 Flags = 0;
+		Reader << Magic << Version << Flags;
+
+		if (Reader.IsError())
+		{
+			UE_LOG(LogFlow, Error, TEXT("SaveGame record of %s is corrupted, record header is truncated"), *Object.GetPathName());
+			return;
+		}
+
+		if (Version > static_cast<uint8>(ECompactRecordVersion::LatestVersion))
+		{
+			UE_LOG(LogFlow, Error, TEXT("SaveGame record of %s has unsupported version %d"), *Object.GetPathName(), Version);
+			return;
+		}
+
+		if (Flags & CompactRecordFlag_Compressed)
+		{
+			int32 UncompressedSize = 0;
+			Reader << UncompressedSize;
+
+			const int64 CompressedPosition = Reader.Tell();
+			if (Reader.IsError() || CompressedPosition >= RecordData.Num() || UncompressedSize <= 0 || UncompressedSize > MaxUncompressedRecordSize)
+			{
+				UE_LOG(LogFlow, Error, TEXT("SaveGame record of %s is corrupted, invalid uncompressed size %d"), *Object.GetPathName(), UncompressedSize);
+				return;
+			}
+
+			TArray<uint8> PayloadData;
+			PayloadData.SetNumUninitialized(UncompressedSize);
+
+			if (!FCompression::UncompressMemory(CompressionFormat, PayloadData.GetData(), UncompressedSize, RecordData.GetData() + CompressedPosition, IntCastChecked<int32>(RecordData.Num() - CompressedPosition)))
+			{
+				UE_LOG(LogFlow, Error, TEXT("Failed to decompress SaveGame record of %s"), *Object.GetPathName());
+				return;
+			}
+
+			ReadPayload(Object, PayloadData);
+		}
+		else
+		{
+			ReadPayload(Object, MakeArrayView(RecordData).RightChop(IntCastChecked<int32>(Reader.Tell())));
+		}
+	}
+}
+
+void FFlowSaveRecordTables::Serialize(FArchive& Ar)
+{
+	int32 NamesNum = Names.Num();
+	Ar << NamesNum;
+
+	if (Ar.IsLoading())
+	{
+		// every name takes at least its length, so a larger count can only come from corrupted data
+		if (NamesNum < 0 || NamesNum > (Ar.TotalSize() - Ar.Tell()) / static_cast<int64>(sizeof(int32)))
+		{
+			Ar.SetError();
+			return;
+		}
+
+		Names.Reset(NamesNum);
+		for (int32 i = 0; i < NamesNum && !Ar.IsError(); i++)
+		{
+			FString NameString;
+			Ar << NameString;
+			Names.Add(FName(*NameString));
+		}
+	}
+	else
+	{
+		for (const FName& Name : Names)
+		{
+			FString NameString = Name.ToString();
+			Ar << NameString;
+		}
+	}
+
+	Ar << ObjectPaths;
+
+	if (Ar.IsLoading() && !Ar.IsError())
+	{
+		// same resolving as FObjectAndNameAsStringProxyArchive with bLoadIfFindFails
+		Objects.Reset(ObjectPaths.Num());
+		for (const FString& ObjectPath : ObjectPaths)
+		{
+			UObject* Object = FindObject<UObject>(nullptr, *ObjectPath, false);
+			if (Object == nullptr)
+			{
+				Object = LoadObject<UObject>(nullptr, *ObjectPath);
+			}
+			Objects.Add(Object);
+		}
+	}
+}
+
+FFlowCompactArchive::FFlowCompactArchive(FArchive& InInnerArchive, FFlowSaveRecordTables& InTables)
+	: FArchiveProxy(InInnerArchive)
+	, Tables(InTables)
+{
+	ArIsSaveGame = true;
+}
+
+FArchive& FFlowCompactArchive::operator<<(FName& Value)
+{
+	uint32 Index = 0;
+
+	if (IsLoading())
+	{
+		SerializeIntPacked(Index);
+		Value = Tables.Names.IsValidIndex(Index) ? Tables.Names[Index] : NAME_None;
+	}
+	else
+	{
+		const int32* FoundIndex = Tables.NameIndices.Find(Value);
+		Index = FoundIndex ? *FoundIndex : Tables.NameIndices.Add(Value, Tables.Names.Add(Value));
+		SerializeIntPacked(Index);
+	}
+
+	return *this;
+}
+
+FArchive& FFlowCompactArchive::operator<<(UObject*& Value)
+{
+	// zero is reserved for null
+	uint32 Index = 0;
+
+	if (IsLoading())
+	{
+		SerializeIntPacked(Index);
+		Value = Index > 0 && Tables.Objects.IsValidIndex(Index - 1) ? Tables.Objects[Index - 1] : nullptr;
+	}
+	else
+	{
+		if (Value)
+		{
+			const FString ObjectPath = Value->GetPathName();
+			const int32* FoundIndex = Tables.ObjectIndices.Find(ObjectPath);
+			Index = 1 + (FoundIndex ? *FoundIndex : Tables.ObjectIndices.Add(ObjectPath, Tables.ObjectPaths.Add(ObjectPath)));
+		}
+		SerializeIntPacked(Index);
+	}
+
+	return *this;
+}
+
+FArchive& FFlowCompactArchive::operator<<(FWeakObjectPtr& Value)
+{
+	return FArchiveUObject::SerializeWeakObjectPtr(*this, Value);
+}
+
+FArchive& FFlowCompactArchive::operator<<(FSoftObjectPtr& Value)
+{
+	return FArchiveUObject::SerializeSoftObjectPtr(*this, Value);
+}
+
+FArchive& FFlowCompactArchive::operator<<(FSoftObjectPath& Value)
+{
+	return FArchiveUObject::SerializeSoftObjectPath(*this, Value);
+}
+
+FArchive& FFlowCompactArchive::operator<<(FObjectPtr& Value)
+{
+	return FArchiveUObject::SerializeObjectPtr(*this, Value);
+}
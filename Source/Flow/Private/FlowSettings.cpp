@@ -9,8 +9,21 @@ UFlowSettings::UFlowSettings(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bCreateFlowSubsystemOnClients(true)
 	, bWarnAboutMissingIdentityTags(true)
+	, bCompactSaveData(false)
+	, bCompressSaveData(false)
+	, SaveDataCompressionThreshold(1024)
+	, bIncrementalSaveData(false)
 	, bLogOnSignalDisabled(true)
 	, bLogOnSignalPassthrough(true)
+	, SignalFrameBudget(0)
+	, bAsyncLoadSubGraphs(false)
+	, SubGraphPrefetchDepth(2)
+	, bShareTemplateNodes(false)
+	, PinRecordsLimit(20)
+	, bPrefetchContent(false)
+	, ContentPrefetchDepth(2)
+	, ContentPrefetchNodeBudget(64)
+	, ContentPrefetchMemoryBudget(0)
 	, bUseAdaptiveNodeTitles(false)
 	, DefaultExpectedOwnerClass(UFlowComponent::StaticClass())
 {
@@ -8,18 +8,53 @@
 #include "FlowSave.h"
 #include "FlowSettings.h"
 #include "Nodes/Graph/FlowNode_SubGraph.h"
+#include "Trace/FlowStats.h"
+#include "Trace/FlowTrace.h"
 
+#include "Async/Async.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 #include "Logging/MessageLog.h"
+#include "Misc/OutputDevice.h"
 #include "Misc/Paths.h"
+#include "TimerManager.h"
 #include "UObject/UObjectHash.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowSubsystem)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Signals"), STAT_FlowDeferredSignals, STATGROUP_Flow);
+
 #if !UE_BUILD_SHIPPING
 FNativeFlowAssetEvent UFlowSubsystem::OnInstancedTemplateAdded;
 FNativeFlowAssetEvent UFlowSubsystem::OnInstancedTemplateRemoved;
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice FlowStatsCommand(
+	TEXT("flow.stats"),
+	TEXT("Prints the most expensive Flow Node classes and template assets, active instances and node memory. Arguments: [TopCount=10] or reset"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+#if FLOW_STATS_ENABLED
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			FFlowNodeStats::Reset();
+			Ar.Logf(TEXT("Flow Node stats reset"));
+			return;
+		}
+#endif
+
+		const int32 TopCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10;
+
+		const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		if (const UFlowSubsystem* FlowSubsystem = GameInstance ? GameInstance->GetSubsystem<UFlowSubsystem>() : nullptr)
+		{
+			FlowSubsystem->DumpStats(TopCount, Ar);
+		}
+		else
+		{
+			Ar.Logf(TEXT("No Flow Subsystem in this world"));
+		}
+	}));
 #endif
 
 #define LOCTEXT_NAMESPACE "FlowSubsystem"
@@ -54,7 +89,22 @@ void UFlowSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UFlowSubsystem::Deinitialize()
 {
+	// callers of SaveGameAsync still receive complete SaveGames
+	while (PendingSaveGames.Num() > 0)
+	{
+		CompleteSaveGameAsync(0);
+	}
+
 	AbortActiveFlows();
+	InstancePools.Empty();
+	DeferredSignalAssets.Empty();
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DeferredSignalsTimerHandle);
+	}
+	DeferredSignalsTimerHandle.Invalidate();
+	ReleaseSaveRecordIndex();
 }
 
 void UFlowSubsystem::AbortActiveFlows()
@@ -197,6 +247,22 @@ UFlowAsset* UFlowSubsystem::CreateSubFlow(UFlowNode_SubGraph* SubGraphNode, cons
 	return NewInstance;
 }
 
+bool UFlowSubsystem::HasPrefetchMemoryBudget() const
+{
+	const int64 BudgetBytes = static_cast<int64>(UFlowSettings::Get()->ContentPrefetchMemoryBudget) * 1024 * 1024;
+	return BudgetBytes <= 0 || PrefetchedContentBytes < BudgetBytes;
+}
+
+void UFlowSubsystem::ReservePrefetchMemory(const int64 Bytes)
+{
+	PrefetchedContentBytes += Bytes;
+}
+
+void UFlowSubsystem::ReleasePrefetchMemory(const int64 Bytes)
+{
+	PrefetchedContentBytes = FMath::Max<int64>(PrefetchedContentBytes - Bytes, 0);
+}
+
 void UFlowSubsystem::RemoveSubFlow(UFlowNode_SubGraph* SubGraphNode, const EFlowFinishPolicy FinishPolicy)
 {
 	if (InstancedSubFlows.Contains(SubGraphNode))
@@ -230,14 +296,25 @@ UFlowAsset* UFlowSubsystem::CreateFlowInstance(const TWeakObjectPtr<UObject> Own
 	}
 #endif
 
+	UFlowAsset* NewInstance = nullptr;
+
 	// it won't be empty, if we're restoring Flow Asset instance from the SaveGame
+	// restored instance needs the saved name, so it can't be taken from the pool
 	if (NewInstanceName.IsEmpty())
 	{
-		NewInstanceName = MakeUniqueObjectName(this, UFlowAsset::StaticClass(), *FPaths::GetBaseFilename(LoadedFlowAsset->GetPathName())).ToString();
+		NewInstance = TakePooledInstance(LoadedFlowAsset);
+		if (NewInstance == nullptr)
+		{
+			NewInstanceName = MakeUniqueObjectName(this, UFlowAsset::StaticClass(), *FPaths::GetBaseFilename(LoadedFlowAsset->GetPathName())).ToString();
+		}
 	}
 
-	UFlowAsset* NewInstance = NewObject<UFlowAsset>(this, LoadedFlowAsset->GetClass(), *NewInstanceName, RF_Transient, LoadedFlowAsset, false, nullptr);
+	if (NewInstance == nullptr)
+	{
+		NewInstance = NewObject<UFlowAsset>(this, LoadedFlowAsset->GetClass(), *NewInstanceName, RF_Transient, LoadedFlowAsset, false, nullptr);
+	}
 	NewInstance->InitializeInstance(Owner, *LoadedFlowAsset);
+	FLOW_TRACE_INSTANCE_CREATED(*NewInstance);
 
 	LoadedFlowAsset->AddInstance(NewInstance);
 
@@ -265,7 +342,129 @@ void UFlowSubsystem::RemoveInstancedTemplate(UFlowAsset* Template)
 #endif
 
 	InstancedTemplates.Remove(Template);
+
+#if WITH_EDITOR
+	// graph might be edited before starting the next PIE session
+	InstancePools.Remove(Template);
+#endif
+}
+
+UFlowAsset* UFlowSubsystem::TakePooledInstance(UFlowAsset* Template)
+{
+	FFlowInstancePool* Pool = InstancePools.Find(Template);
+	if (Pool == nullptr)
+	{
+		return nullptr;
+	}
+
+	while (Pool->Instances.Num() > 0)
+	{
+		if (UFlowAsset* PooledInstance = Pool->Instances.Pop(EAllowShrinking::No))
+		{
+			return PooledInstance;
+		}
+	}
+
+	return nullptr;
+}
+
+bool UFlowSubsystem::TryPoolInstance(UFlowAsset* Template, UFlowAsset& Instance)
+{
+	if (Template == nullptr || Template->InstancePoolSize <= 0 || Instance.GetOuter() != this || !Instance.CanBePooled())
+	{
+		return false;
+	}
+
+#if WITH_EDITOR
+	// graph might be edited before starting the next PIE session
+	if (Template->ActiveInstances.Num() == 0)
+	{
+		return false;
+	}
+#endif
+
+	FFlowInstancePool& Pool = InstancePools.FindOrAdd(Template);
+	if (Pool.Instances.Num() >= Template->InstancePoolSize)
+	{
+		return false;
+	}
+
+	Instance.ResetInstance(*Template);
+	Instance.bPooledInstance = true;
+	Pool.Instances.Add(&Instance);
+
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+void UFlowSubsystem::DumpStats(const int32 TopCount, FOutputDevice& Ar) const
+{
+#if FLOW_STATS_ENABLED
+	FFlowNodeStats::Dump(TopCount, Ar);
+#endif
+
+	struct FTemplateStats
+	{
+		const UFlowAsset* Template = nullptr;
+		int32 ActiveInstances = 0;
+		int32 PooledInstances = 0;
+		int32 NodeObjects = 0;
+		int64 NodeBytes = 0;
+	};
+
+	TArray<FTemplateStats> TemplateStats;
+	for (UFlowAsset* Template : InstancedTemplates)
+	{
+		FTemplateStats& Stats = TemplateStats.AddDefaulted_GetRef();
+		Stats.Template = Template;
+		Stats.ActiveInstances = Template->ActiveInstances.Num();
+		const FFlowInstancePool* Pool = InstancePools.Find(Template);
+		const TArray<TObjectPtr<UFlowAsset>> NoPooledInstances;
+		const TArray<TObjectPtr<UFlowAsset>>& PooledInstances = Pool ? Pool->Instances : NoPooledInstances;
+		Stats.PooledInstances = PooledInstances.Num();
+
+		// nodes are outered to their instance and AddOns to their nodes, so nested search finds all of them
+		TArray<UObject*> NodeObjects;
+		for (const TArray<TObjectPtr<UFlowAsset>>* Instances : {&Template->ActiveInstances, &PooledInstances})
+		{
+			for (const UFlowAsset* Instance : *Instances)
+			{
+				GetObjectsWithOuter(Instance, NodeObjects, true);
+			}
+		}
+
+		for (const UObject* Object : NodeObjects)
+		{
+			if (Object->IsA<UFlowNodeBase>())
+			{
+				Stats.NodeObjects++;
+				Stats.NodeBytes += Object->GetClass()->GetStructureSize() + Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+			}
+		}
+	}
+
+	TemplateStats.Sort([](const FTemplateStats& A, const FTemplateStats& B)
+	{
+		return A.NodeBytes > B.NodeBytes;
+	});
+
+	int32 TotalInstances = 0;
+	int64 TotalBytes = 0;
+	for (const FTemplateStats& Stats : TemplateStats)
+	{
+		TotalInstances += Stats.ActiveInstances;
+		TotalBytes += Stats.NodeBytes;
+	}
+
+	Ar.Logf(TEXT("Instanced templates: %d, active instances: %d, node memory: %.1f KB"), TemplateStats.Num(), TotalInstances, TotalBytes / 1024.0);
+	for (int32 Index = 0; Index < FMath::Min(TopCount, TemplateStats.Num()); Index++)
+	{
+		const FTemplateStats& Stats = TemplateStats[Index];
+		Ar.Logf(TEXT("  %4d active %4d pooled %6d nodes %10.1f KB  %s"),
+			Stats.ActiveInstances, Stats.PooledInstances, Stats.NodeObjects, Stats.NodeBytes / 1024.0, *Stats.Template->GetPathName());
+	}
 }
+#endif
 
 TMap<UObject*, UFlowAsset*> UFlowSubsystem::GetRootInstances() const
 {
@@ -306,32 +505,196 @@ UWorld* UFlowSubsystem::GetWorld() const
 	return GetGameInstance()->GetWorld();
 }
 
+void UFlowSubsystem::BeginSignalExecution()
+{
+	if (SignalExecutionDepth++ > 0)
+	{
+		return;
+	}
+
+	if (SignalBudgetFrame != GFrameCounter)
+	{
+		SignalBudgetFrame = GFrameCounter;
+		SignalCyclesThisFrame = 0;
+		DeferredSignalsThisFrame = 0;
+	}
+
+	SignalExecutionStartCycles = FPlatformTime::Cycles64();
+}
+
+void UFlowSubsystem::EndSignalExecution()
+{
+	check(SignalExecutionDepth > 0);
+
+	if (--SignalExecutionDepth == 0)
+	{
+		SignalCyclesThisFrame += FPlatformTime::Cycles64() - SignalExecutionStartCycles;
+	}
+}
+
+bool UFlowSubsystem::HasSignalBudget() const
+{
+	const int32 BudgetMicroseconds = UFlowSettings::Get()->SignalFrameBudget;
+	if (BudgetMicroseconds <= 0 || SignalBudgetFrame != GFrameCounter)
+	{
+		return true;
+	}
+
+	// without a world there's no timer to execute deferred signals, so they are executed right away
+	if (GetWorld() == nullptr)
+	{
+		return true;
+	}
+
+	uint64 SpentCycles = SignalCyclesThisFrame;
+	if (SignalExecutionDepth > 0)
+	{
+		SpentCycles += FPlatformTime::Cycles64() - SignalExecutionStartCycles;
+	}
+
+	return FPlatformTime::ToMilliseconds64(SpentCycles) * 1000.0 < BudgetMicroseconds;
+}
+
+void UFlowSubsystem::DeferSignals(UFlowAsset* FlowAsset)
+{
+	if (SignalBudgetFrame != GFrameCounter)
+	{
+		SignalBudgetFrame = GFrameCounter;
+		SignalCyclesThisFrame = 0;
+		DeferredSignalsThisFrame = 0;
+	}
+
+	const int32 SignalsNum = FlowAsset->GetPendingSignalsNum();
+	DeferredSignalsThisFrame += SignalsNum;
+	TotalDeferredSignals += SignalsNum;
+	INC_DWORD_STAT_BY(STAT_FlowDeferredSignals, SignalsNum);
+
+	DeferredSignalAssets.AddUnique(FlowAsset);
+
+	UWorld* World = GetWorld();
+	if (ensure(World) && !World->GetTimerManager().TimerExists(DeferredSignalsTimerHandle))
+	{
+		DeferredSignalsTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UFlowSubsystem::ExecuteDeferredSignals);
+	}
+}
+
+void UFlowSubsystem::ExecuteDeferredSignals()
+{
+	// executing timer still exists, invalidate it so signals deferred again would schedule a new one
+	DeferredSignalsTimerHandle.Invalidate();
+
+	// instances running out of budget again will add themselves to the fresh list
+	TArray<TWeakObjectPtr<UFlowAsset>> FlowAssets = MoveTemp(DeferredSignalAssets);
+	FlowAssets.RemoveAll([](const TWeakObjectPtr<UFlowAsset>& FlowAsset)
+	{
+		return !FlowAsset.IsValid();
+	});
+
+	// stable sort keeps the order of deferring among instances of the same priority
+	FlowAssets.StableSort([](const TWeakObjectPtr<UFlowAsset>& A, const TWeakObjectPtr<UFlowAsset>& B)
+	{
+		return A->GetSignalPriority() > B->GetSignalPriority();
+	});
+
+	for (const TWeakObjectPtr<UFlowAsset>& FlowAsset : FlowAssets)
+	{
+		if (FlowAsset.IsValid())
+		{
+			FlowAsset->ExecutePendingSignals();
+		}
+	}
+}
+
 void UFlowSubsystem::OnGameSaved(UFlowSaveGame* SaveGame)
 {
-	// clear existing data, in case we received reused SaveGame instance
-	// we only remove data for the current world + global Flow Graph instances (i.e. not bound to any world if created by UGameInstanceSubsystem)
-	// we keep data bound to other worlds
-	if (GetWorld())
+	if (IsSaveGamePending(SaveGame))
+	{
+		UE_LOG(LogFlow, Error, TEXT("Can't save Flow records to %s, it's still being saved asynchronously"), *GetNameSafe(SaveGame));
+		return;
+	}
+
+	FFlowSaveSnapshot Snapshot;
+	CaptureSaveSnapshot(SaveGame, Snapshot);
+	FlowSave::EncodeSnapshot(Snapshot);
+	ApplySaveSnapshot(SaveGame, Snapshot);
+}
+
+void UFlowSubsystem::SaveGameAsync(UFlowSaveGame* SaveGame, const FFlowSaveGameEvent& OnCompleted)
+{
+	if (SaveGame == nullptr || IsSaveGamePending(SaveGame))
+	{
+		UE_LOG(LogFlow, Error, TEXT("Can't save Flow records to %s, it's missing or still being saved asynchronously"), *GetNameSafe(SaveGame));
+		return;
+	}
+
+	const TSharedRef<FFlowSaveSnapshot> Snapshot = MakeShared<FFlowSaveSnapshot>();
+	CaptureSaveSnapshot(SaveGame, *Snapshot);
+
+	FFlowPendingSaveGame& PendingSave = PendingSaveGames.AddDefaulted_GetRef();
+	PendingSave.SaveGame = SaveGame;
+	PendingSave.OnCompleted = OnCompleted;
+	PendingSave.Snapshot = Snapshot;
+	PendingSave.Encoding = Async(EAsyncExecution::TaskGraph, [WeakThis = TWeakObjectPtr<UFlowSubsystem>(this), WeakSaveGame = TWeakObjectPtr<UFlowSaveGame>(SaveGame), Snapshot]()
 	{
-		const FString& WorldName = GetWorld()->GetName();
+		FlowSave::EncodeSnapshot(*Snapshot);
 
-		for (int32 i = SaveGame->FlowInstances.Num() - 1; i >= 0; i--)
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakSaveGame]()
 		{
-			if (SaveGame->FlowInstances[i].WorldName.IsEmpty() || SaveGame->FlowInstances[i].WorldName == WorldName)
+			// pending save is gone if the subsystem was deinitialized meanwhile, Deinitialize completes all of them
+			UFlowSubsystem* FlowSubsystem = WeakThis.Get();
+			if (FlowSubsystem == nullptr)
 			{
-				SaveGame->FlowInstances.RemoveAt(i);
+				return;
 			}
-		}
 
-		for (int32 i = SaveGame->FlowComponents.Num() - 1; i >= 0; i--)
-		{
-			if (SaveGame->FlowComponents[i].WorldName.IsEmpty() || SaveGame->FlowComponents[i].WorldName == WorldName)
+			const UFlowSaveGame* SaveGame = WeakSaveGame.Get();
+			const int32 PendingIndex = FlowSubsystem->PendingSaveGames.IndexOfByPredicate([SaveGame](const FFlowPendingSaveGame& PendingSave) { return PendingSave.SaveGame == SaveGame; });
+			if (PendingIndex != INDEX_NONE)
 			{
-				SaveGame->FlowComponents.RemoveAt(i);
+				FlowSubsystem->CompleteSaveGameAsync(PendingIndex);
 			}
-		}
+		});
+	}).Share();
+}
+
+void UFlowSubsystem::CompleteSaveGameAsync(const int32 PendingIndex)
+{
+	const FFlowPendingSaveGame PendingSave = PendingSaveGames[PendingIndex];
+	PendingSaveGames.RemoveAt(PendingIndex);
+
+	// SaveGame was referenced only by the subsystem, nobody waits for it
+	if (PendingSave.SaveGame == nullptr)
+	{
+		return;
+	}
+
+	// the worker might still be returning from the encoding task, or be running it if we're deinitializing
+	PendingSave.Encoding.Wait();
+	ApplySaveSnapshot(PendingSave.SaveGame, *PendingSave.Snapshot);
+
+	PendingSave.OnCompleted.ExecuteIfBound(PendingSave.SaveGame);
+}
+
+void UFlowSubsystem::CaptureSaveSnapshot(UFlowSaveGame* SaveGame, FFlowSaveSnapshot& OutSnapshot)
+{
+	// records are about to change, if we received the loaded SaveGame instance
+	if (SaveGame == LoadedSaveGame)
+	{
+		ReleaseSaveRecordIndex();
+	}
+
+	// existing data is filtered while encoding, in case we received reused SaveGame instance
+	OutSnapshot.PreviousFlowInstances = MoveTemp(SaveGame->FlowInstances);
+	OutSnapshot.PreviousFlowComponents = MoveTemp(SaveGame->FlowComponents);
+	if (GetWorld())
+	{
+		OutSnapshot.WorldName = GetWorld()->GetName();
 	}
 
+	const UFlowSettings* Settings = UFlowSettings::Get();
+	OutSnapshot.bCompressRecords = Settings->bCompactSaveData && Settings->bCompressSaveData;
+	OutSnapshot.CompressionThreshold = Settings->SaveDataCompressionThreshold;
+
 	// save Flow Graphs
 	for (const TPair<UFlowAsset*, TWeakObjectPtr<UObject>>& RootInstance : ObjectPtrDecay(RootInstances))
 	{
@@ -339,11 +702,11 @@ void UFlowSubsystem::OnGameSaved(UFlowSaveGame* SaveGame)
 		{
 			if (UFlowComponent* FlowComponent = Cast<UFlowComponent>(RootInstance.Value))
 			{
-				FlowComponent->SaveRootFlow(SaveGame->FlowInstances);
+				FlowComponent->SaveRootFlow(OutSnapshot.FlowInstances);
 			}
 			else
 			{
-				RootInstance.Key->SaveInstance(SaveGame->FlowInstances);
+				RootInstance.Key->CaptureInstance(OutSnapshot.FlowInstances);
 			}
 		}
 	}
@@ -357,18 +720,28 @@ void UFlowSubsystem::OnGameSaved(UFlowSaveGame* SaveGame)
 		// ensure uniqueness of entries
 		const TSet<TWeakObjectPtr<UFlowComponent>> RegisteredComponents = TSet<TWeakObjectPtr<UFlowComponent>>(ComponentsArray);
 
-		// write archives to SaveGame
+		// write archives to snapshot
+		OutSnapshot.FlowComponents.Reserve(RegisteredComponents.Num());
 		for (const TWeakObjectPtr<UFlowComponent> RegisteredComponent : RegisteredComponents)
 		{
-			SaveGame->FlowComponents.Emplace(RegisteredComponent->SaveInstance());
+			OutSnapshot.FlowComponents.Add(RegisteredComponent->SaveInstance());
 		}
 	}
 }
 
+void UFlowSubsystem::ApplySaveSnapshot(UFlowSaveGame* SaveGame, FFlowSaveSnapshot& Snapshot)
+{
+	SaveGame->FlowInstances = MoveTemp(Snapshot.FlowInstances);
+	SaveGame->FlowComponents = MoveTemp(Snapshot.FlowComponents);
+}
+
 void UFlowSubsystem::OnGameLoaded(UFlowSaveGame* SaveGame)
 {
 	LoadedSaveGame = SaveGame;
 
+	ReleaseSaveRecordIndex();
+	BuildSaveRecordIndex();
+
 	// here's opportunity to apply loaded data to custom systems
 	// it's recommended to do this by overriding method in the subclass
 }
@@ -380,17 +753,12 @@ void UFlowSubsystem::LoadRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const F
 		return;
 	}
 
-	for (const FFlowAssetSaveData& AssetRecord : LoadedSaveGame->FlowInstances)
+	if (const FFlowAssetSaveData* AssetRecord = FindSavedFlowInstanceRecord(SavedAssetInstanceName, FlowAsset->IsBoundToWorld()))
 	{
-		if (AssetRecord.InstanceName == SavedAssetInstanceName
-			&& (FlowAsset->IsBoundToWorld() == false || AssetRecord.WorldName == GetWorld()->GetName()))
+		UFlowAsset* LoadedInstance = CreateRootFlow(Owner, FlowAsset, bAllowMultipleInstances);
+		if (LoadedInstance)
 		{
-			UFlowAsset* LoadedInstance = CreateRootFlow(Owner, FlowAsset, bAllowMultipleInstances);
-			if (LoadedInstance)
-			{
-				LoadedInstance->LoadInstance(AssetRecord);
-			}
-			return;
+			LoadedInstance->LoadInstance(*AssetRecord);
 		}
 	}
 }
@@ -404,19 +772,94 @@ void UFlowSubsystem::LoadSubFlow(UFlowNode_SubGraph* SubGraphNode, const FString
 
 	UFlowAsset* SubGraphAsset = SubGraphNode->Asset.LoadSynchronous();
 
-	for (const FFlowAssetSaveData& AssetRecord : LoadedSaveGame->FlowInstances)
+	const bool bMatchWorld = SubGraphAsset == nullptr || SubGraphAsset->IsBoundToWorld();
+
+	if (const FFlowAssetSaveData* AssetRecord = FindSavedFlowInstanceRecord(SavedAssetInstanceName, bMatchWorld))
+	{
+		UFlowAsset* LoadedInstance = CreateSubFlow(SubGraphNode, SavedAssetInstanceName);
+		if (LoadedInstance)
+		{
+			LoadedInstance->LoadInstance(*AssetRecord);
+		}
+	}
+}
+
+const FFlowComponentSaveData* UFlowSubsystem::FindSavedComponentRecord(const FString& WorldName, const FString& ActorInstanceName)
+{
+	if (LoadedSaveGame == nullptr)
+	{
+		return nullptr;
+	}
+
+	BuildSaveRecordIndex();
+
+	if (const TMap<FString, int32>* WorldComponents = SavedComponentIndices.Find(WorldName))
+	{
+		if (const int32* RecordIndex = WorldComponents->Find(ActorInstanceName))
+		{
+			return &LoadedSaveGame->FlowComponents[*RecordIndex];
+		}
+	}
+
+	return nullptr;
+}
+
+const FFlowAssetSaveData* UFlowSubsystem::FindSavedFlowInstanceRecord(const FString& InstanceName, const bool bMatchWorld)
+{
+	if (LoadedSaveGame == nullptr)
+	{
+		return nullptr;
+	}
+
+	BuildSaveRecordIndex();
+
+	if (const FlowArray::TInlineArray<int32, 1>* RecordIndices = SavedFlowInstanceIndices.Find(InstanceName))
 	{
-		if (AssetRecord.InstanceName == SavedAssetInstanceName
-			&& ((SubGraphAsset && SubGraphAsset->IsBoundToWorld() == false) || AssetRecord.WorldName == GetWorld()->GetName()))
+		for (const int32 RecordIndex : *RecordIndices)
 		{
-			UFlowAsset* LoadedInstance = CreateSubFlow(SubGraphNode, SavedAssetInstanceName);
-			if (LoadedInstance)
+			const FFlowAssetSaveData& AssetRecord = LoadedSaveGame->FlowInstances[RecordIndex];
+			if (bMatchWorld == false || AssetRecord.WorldName == GetWorld()->GetName())
 			{
-				LoadedInstance->LoadInstance(AssetRecord);
+				return &AssetRecord;
 			}
-			return;
 		}
 	}
+
+	return nullptr;
+}
+
+void UFlowSubsystem::BuildSaveRecordIndex()
+{
+	if (bSaveRecordIndexBuilt || LoadedSaveGame == nullptr)
+	{
+		return;
+	}
+
+	// the first record wins, same as when records were searched in order
+	for (int32 i = 0; i < LoadedSaveGame->FlowComponents.Num(); i++)
+	{
+		const FFlowComponentSaveData& ComponentRecord = LoadedSaveGame->FlowComponents[i];
+		TMap<FString, int32>& WorldComponents = SavedComponentIndices.FindOrAdd(ComponentRecord.WorldName);
+		if (!WorldComponents.Contains(ComponentRecord.ActorInstanceName))
+		{
+			WorldComponents.Add(ComponentRecord.ActorInstanceName, i);
+		}
+	}
+
+	SavedFlowInstanceIndices.Reserve(LoadedSaveGame->FlowInstances.Num());
+	for (int32 i = 0; i < LoadedSaveGame->FlowInstances.Num(); i++)
+	{
+		SavedFlowInstanceIndices.FindOrAdd(LoadedSaveGame->FlowInstances[i].InstanceName).Add(i);
+	}
+
+	bSaveRecordIndexBuilt = true;
+}
+
+void UFlowSubsystem::ReleaseSaveRecordIndex()
+{
+	SavedComponentIndices.Empty();
+	SavedFlowInstanceIndices.Empty();
+	bSaveRecordIndexBuilt = false;
 }
 
 void UFlowSubsystem::RegisterComponent(UFlowComponent* Component)
@@ -425,25 +868,25 @@ void UFlowSubsystem::RegisterComponent(UFlowComponent* Component)
 	{
 		if (Tag.IsValid())
 		{
-			FlowComponentRegistry.Emplace(Tag, Component);
+			AddToComponentRegistry(Component, Tag);
 		}
 	}
 
-	OnComponentRegistered.Broadcast(Component);
+	BroadcastComponentRegistered(Component);
 }
 
 void UFlowSubsystem::OnIdentityTagAdded(UFlowComponent* Component, const FGameplayTag& AddedTag)
 {
-	FlowComponentRegistry.Emplace(AddedTag, Component);
+	AddToComponentRegistry(Component, AddedTag);
 
 	// broadcast OnComponentRegistered only if this component wasn't present in the registry previously
 	if (Component->IdentityTags.Num() > 1)
 	{
-		OnComponentTagAdded.Broadcast(Component, FGameplayTagContainer(AddedTag));
+		BroadcastComponentTagAdded(Component, FGameplayTagContainer(AddedTag));
 	}
 	else
 	{
-		OnComponentRegistered.Broadcast(Component);
+		BroadcastComponentRegistered(Component);
 	}
 }
 
@@ -451,17 +894,17 @@ void UFlowSubsystem::OnIdentityTagsAdded(UFlowComponent* Component, const FGamep
 {
 	for (const FGameplayTag& Tag : AddedTags)
 	{
-		FlowComponentRegistry.Emplace(Tag, Component);
+		AddToComponentRegistry(Component, Tag);
 	}
 
 	// broadcast OnComponentRegistered only if this component wasn't present in the registry previously
 	if (Component->IdentityTags.Num() > AddedTags.Num())
 	{
-		OnComponentTagAdded.Broadcast(Component, AddedTags);
+		BroadcastComponentTagAdded(Component, AddedTags);
 	}
 	else
 	{
-		OnComponentRegistered.Broadcast(Component);
+		BroadcastComponentRegistered(Component);
 	}
 }
 
@@ -471,25 +914,25 @@ void UFlowSubsystem::UnregisterComponent(UFlowComponent* Component)
 	{
 		if (Tag.IsValid())
 		{
-			FlowComponentRegistry.Remove(Tag, Component);
+			RemoveFromComponentRegistry(Component, Tag);
 		}
 	}
 
-	OnComponentUnregistered.Broadcast(Component);
+	BroadcastComponentUnregistered(Component, FGameplayTagContainer::EmptyContainer);
 }
 
 void UFlowSubsystem::OnIdentityTagRemoved(UFlowComponent* Component, const FGameplayTag& RemovedTag)
 {
-	FlowComponentRegistry.Remove(RemovedTag, Component);
+	RemoveFromComponentRegistry(Component, RemovedTag);
 
 	// broadcast OnComponentUnregistered only if this component isn't present in the registry anymore
 	if (Component->IdentityTags.Num() > 0)
 	{
-		OnComponentTagRemoved.Broadcast(Component, FGameplayTagContainer(RemovedTag));
+		BroadcastComponentTagRemoved(Component, FGameplayTagContainer(RemovedTag));
 	}
 	else
 	{
-		OnComponentUnregistered.Broadcast(Component);
+		BroadcastComponentUnregistered(Component, FGameplayTagContainer(RemovedTag));
 	}
 }
 
@@ -497,169 +940,354 @@ void UFlowSubsystem::OnIdentityTagsRemoved(UFlowComponent* Component, const FGam
 {
 	for (const FGameplayTag& Tag : RemovedTags)
 	{
-		FlowComponentRegistry.Remove(Tag, Component);
+		RemoveFromComponentRegistry(Component, Tag);
 	}
 
 	// broadcast OnComponentUnregistered only if this component isn't present in the registry anymore
 	if (Component->IdentityTags.Num() > 0)
 	{
-		OnComponentTagRemoved.Broadcast(Component, RemovedTags);
+		BroadcastComponentTagRemoved(Component, RemovedTags);
 	}
 	else
 	{
-		OnComponentUnregistered.Broadcast(Component);
+		BroadcastComponentUnregistered(Component, RemovedTags);
 	}
 }
 
-TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
+void UFlowSubsystem::BroadcastComponentRegistered(UFlowComponent* Component)
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
+	OnComponentRegistered.Broadcast(Component);
 
-	TSet<UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	FFlowComponentObserverSet Observers;
+	GatherComponentObservers(Component->IdentityTags, Observers);
+
+	for (const FDelegateHandle& Handle : Observers)
 	{
-		if (Component.IsValid() && Component->GetClass()->IsChildOf(ComponentClass))
+		// observer might have been removed by previously called observer
+		if (const FFlowComponentObserver* Observer = ComponentObservers.Find(Handle))
 		{
-			Result.Emplace(Component.Get());
+			// copy delegate, as the call might add new observers and reallocate the map
+			const FNativeFlowComponentEvent Delegate = Observer->OnComponentRegistered;
+			Delegate.ExecuteIfBound(Component);
 		}
 	}
-
-	return Result;
 }
 
-TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
+void UFlowSubsystem::BroadcastComponentTagAdded(UFlowComponent* Component, const FGameplayTagContainer& AddedTags)
 {
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
+	OnComponentTagAdded.Broadcast(Component, AddedTags);
 
-	TSet<UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	FFlowComponentObserverSet Observers;
+	GatherComponentObservers(Component->IdentityTags, Observers);
+
+	for (const FDelegateHandle& Handle : Observers)
 	{
-		if (Component.IsValid() && Component->GetClass()->IsChildOf(ComponentClass))
+		if (const FFlowComponentObserver* Observer = ComponentObservers.Find(Handle))
 		{
-			Result.Emplace(Component.Get());
+			const FNativeTaggedFlowComponentEvent Delegate = Observer->OnComponentTagAdded;
+			Delegate.ExecuteIfBound(Component, AddedTags);
 		}
 	}
+}
 
-	return Result;
+void UFlowSubsystem::BroadcastComponentTagRemoved(UFlowComponent* Component, const FGameplayTagContainer& RemovedTags)
+{
+	OnComponentTagRemoved.Broadcast(Component, RemovedTags);
+
+	// observers matching removed tags need to be informed too
+	FFlowComponentObserverSet Observers;
+	GatherComponentObservers(Component->IdentityTags, Observers);
+	GatherComponentObservers(RemovedTags, Observers);
+
+	for (const FDelegateHandle& Handle : Observers)
+	{
+		if (const FFlowComponentObserver* Observer = ComponentObservers.Find(Handle))
+		{
+			const FNativeTaggedFlowComponentEvent Delegate = Observer->OnComponentTagRemoved;
+			Delegate.ExecuteIfBound(Component, RemovedTags);
+		}
+	}
 }
 
-TSet<AActor*> UFlowSubsystem::GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+void UFlowSubsystem::BroadcastComponentUnregistered(UFlowComponent* Component, const FGameplayTagContainer& RemovedTags)
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
+	OnComponentUnregistered.Broadcast(Component);
 
-	TSet<AActor*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	FFlowComponentObserverSet Observers;
+	GatherComponentObservers(Component->IdentityTags, Observers);
+	GatherComponentObservers(RemovedTags, Observers);
+
+	for (const FDelegateHandle& Handle : Observers)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		if (const FFlowComponentObserver* Observer = ComponentObservers.Find(Handle))
 		{
-			Result.Emplace(Component->GetOwner());
+			const FNativeFlowComponentEvent Delegate = Observer->OnComponentUnregistered;
+			Delegate.ExecuteIfBound(Component);
 		}
 	}
+}
 
-	return Result;
+void UFlowSubsystem::GatherComponentObservers(const FGameplayTagContainer& ComponentTags, FFlowComponentObserverSet& OutObservers) const
+{
+	if (ComponentObservers.Num() == 0)
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : ComponentTags)
+	{
+		for (TMultiMap<FGameplayTag, FDelegateHandle>::TConstKeyIterator It = ExactComponentObservers.CreateConstKeyIterator(Tag); It; ++It)
+		{
+			OutObservers.Add(It.Value());
+		}
+
+		if (HierarchicalComponentObservers.Num() > 0)
+		{
+			for (FGameplayTag ParentTag = Tag; ParentTag.IsValid(); ParentTag = ParentTag.RequestDirectParent())
+			{
+				for (TMultiMap<FGameplayTag, FDelegateHandle>::TConstKeyIterator It = HierarchicalComponentObservers.CreateConstKeyIterator(ParentTag); It; ++It)
+				{
+					OutObservers.Add(It.Value());
+				}
+			}
+		}
+	}
 }
 
-TSet<AActor*> UFlowSubsystem::GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+FDelegateHandle UFlowSubsystem::AddComponentObserver(const FFlowComponentObserver& Observer)
 {
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
+	if (!ensureMsgf(Observer.IdentityTags.IsValid(), TEXT("Flow Component observer requires at least one Identity Tag")))
+	{
+		return FDelegateHandle();
+	}
 
-	TSet<AActor*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	const FDelegateHandle Handle(FDelegateHandle::GenerateNewHandle);
+	ComponentObservers.Emplace(Handle, Observer);
+
+	TMultiMap<FGameplayTag, FDelegateHandle>& RoutingMap = Observer.RequiresExactMatch() ? ExactComponentObservers : HierarchicalComponentObservers;
+	if (Observer.MatchType == EFlowTagContainerMatchType::HasAny || Observer.MatchType == EFlowTagContainerMatchType::HasAnyExact)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		for (const FGameplayTag& Tag : Observer.IdentityTags)
 		{
-			Result.Emplace(Component->GetOwner());
+			RoutingMap.Add(Tag, Handle);
 		}
 	}
+	else
+	{
+		// component matching all tags has to match the first one
+		RoutingMap.Add(Observer.IdentityTags.First(), Handle);
+	}
 
-	return Result;
+	return Handle;
 }
 
-TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+void UFlowSubsystem::RemoveComponentObserver(FDelegateHandle& Handle)
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
-
-	TMap<AActor*, UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	FFlowComponentObserver Observer;
+	if (ComponentObservers.RemoveAndCopyValue(Handle, Observer))
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		TMultiMap<FGameplayTag, FDelegateHandle>& RoutingMap = Observer.RequiresExactMatch() ? ExactComponentObservers : HierarchicalComponentObservers;
+		for (const FGameplayTag& Tag : Observer.IdentityTags)
 		{
-			Result.Emplace(Component->GetOwner(), Component.Get());
+			RoutingMap.Remove(Tag, Handle);
 		}
 	}
 
-	return Result;
+	Handle.Reset();
 }
 
-TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+void UFlowSubsystem::AddToComponentRegistry(UFlowComponent* Component, const FGameplayTag& Tag)
 {
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
+	ensureMsgf(ComponentRegistryIterationDepth == 0, TEXT("Flow Component registry modified while iterating it with ForEachComponent. Component: %s"), *GetNameSafe(Component));
 
-	TMap<AActor*, UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	FlowComponentRegistry.Emplace(Tag, Component);
+
+	// returned container includes the tag itself
+	for (const FGameplayTag& ParentTag : Tag.GetGameplayTagParents())
+	{
+		FlowComponentTagHierarchy.FindOrAdd(ParentTag).FindOrAdd(Component)++;
+	}
+}
+
+void UFlowSubsystem::RemoveFromComponentRegistry(UFlowComponent* Component, const FGameplayTag& Tag)
+{
+	ensureMsgf(ComponentRegistryIterationDepth == 0, TEXT("Flow Component registry modified while iterating it with ForEachComponent. Component: %s"), *GetNameSafe(Component));
+
+	FlowComponentRegistry.Remove(Tag, Component);
+
+	// other Identity Tags of this component might share the same parents, so we remove component only if nothing references it anymore
+	for (const FGameplayTag& ParentTag : Tag.GetGameplayTagParents())
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		if (TMap<TWeakObjectPtr<UFlowComponent>, int32>* ComponentsPerTag = FlowComponentTagHierarchy.Find(ParentTag))
 		{
-			Result.Emplace(Component->GetOwner(), Component.Get());
+			int32* TagCount = ComponentsPerTag->Find(Component);
+			if (TagCount && --(*TagCount) <= 0)
+			{
+				ComponentsPerTag->Remove(Component);
+				if (ComponentsPerTag->IsEmpty())
+				{
+					FlowComponentTagHierarchy.Remove(ParentTag);
+				}
+			}
 		}
 	}
-
-	return Result;
 }
 
-void UFlowSubsystem::FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+void UFlowSubsystem::ForEachComponent(const FGameplayTag& Tag, const bool bExactMatch, const TFunctionRef<bool(UFlowComponent*)> Func) const
 {
+	TGuardValue<int32> IterationGuard(ComponentRegistryIterationDepth, ComponentRegistryIterationDepth + 1);
+
 	if (bExactMatch)
 	{
-		FlowComponentRegistry.MultiFind(Tag, OutComponents);
+		for (TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>>::TConstKeyIterator It = FlowComponentRegistry.CreateConstKeyIterator(Tag); It; ++It)
+		{
+			UFlowComponent* Component = It.Value().Get();
+			if (Component && !Func(Component))
+			{
+				return;
+			}
+		}
 	}
-	else
+	else if (const TMap<TWeakObjectPtr<UFlowComponent>, int32>* ComponentsPerTag = FlowComponentTagHierarchy.Find(Tag))
 	{
-		for (TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>>::TConstIterator It(FlowComponentRegistry); It; ++It)
+		for (const TPair<TWeakObjectPtr<UFlowComponent>, int32>& Entry : *ComponentsPerTag)
 		{
-			if (It.Key().MatchesTag(Tag))
+			UFlowComponent* Component = Entry.Key.Get();
+			if (Component && !Func(Component))
 			{
-				OutComponents.Emplace(It.Value());
+				return;
 			}
 		}
 	}
 }
 
-void UFlowSubsystem::FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+void UFlowSubsystem::ForEachComponent(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, const TFunctionRef<bool(UFlowComponent*)> Func) const
 {
+	if (Tags.IsEmpty())
+	{
+		return;
+	}
+
 	if (MatchType == EGameplayContainerMatchType::Any)
 	{
-		for (const FGameplayTag& Tag : Tags)
+		bool bContinue = true;
+		for (int32 TagIndex = 0; bContinue && TagIndex < Tags.Num(); TagIndex++)
 		{
-			TArray<TWeakObjectPtr<UFlowComponent>> ComponentsPerTag;
-			FindComponents(Tag, bExactMatch, ComponentsPerTag);
-			OutComponents.Append(ComponentsPerTag);
+			ForEachComponent(Tags.GetByIndex(TagIndex), bExactMatch, [&](UFlowComponent* Component)
+			{
+				// skip component if it has been already visited while iterating one of the previous tags
+				for (int32 PreviousIndex = 0; PreviousIndex < TagIndex; PreviousIndex++)
+				{
+					const FGameplayTag& PreviousTag = Tags.GetByIndex(PreviousIndex);
+					if (bExactMatch ? Component->IdentityTags.HasTagExact(PreviousTag) : Component->IdentityTags.HasTag(PreviousTag))
+					{
+						return true;
+					}
+				}
+
+				bContinue = Func(Component);
+				return bContinue;
+			});
 		}
 	}
 	else // EGameplayContainerMatchType::All
 	{
-		TSet<TWeakObjectPtr<UFlowComponent>> ComponentsWithAnyTag;
-		for (const FGameplayTag& Tag : Tags)
+		// component having all Identity Tags is always registered under the first one
+		ForEachComponent(Tags.First(), true, [&Tags, &Func](UFlowComponent* Component)
+		{
+			return Component->IdentityTags.HasAllExact(Tags) ? Func(Component) : true;
+		});
+	}
+}
+
+TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
+{
+	TSet<UFlowComponent*> Result;
+	ForEachComponent(Tag, bExactMatch, [&Result, &ComponentClass](UFlowComponent* Component)
+	{
+		if (Component->GetClass()->IsChildOf(ComponentClass))
 		{
-			TArray<TWeakObjectPtr<UFlowComponent>> ComponentsPerTag;
-			FindComponents(Tag, bExactMatch, ComponentsPerTag);
-			ComponentsWithAnyTag.Append(ComponentsPerTag);
+			Result.Emplace(Component);
 		}
+		return true;
+	});
+
+	return Result;
+}
 
-		for (const TWeakObjectPtr<UFlowComponent>& Component : ComponentsWithAnyTag)
+TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
+{
+	TSet<UFlowComponent*> Result;
+	ForEachComponent(Tags, MatchType, bExactMatch, [&Result, &ComponentClass](UFlowComponent* Component)
+	{
+		if (Component->GetClass()->IsChildOf(ComponentClass))
 		{
-			if (Component.IsValid() && Component->IdentityTags.HasAllExact(Tags))
-			{
-				OutComponents.Emplace(Component);
-			}
+			Result.Emplace(Component);
 		}
-	}
+		return true;
+	});
+
+	return Result;
+}
+
+TSet<AActor*> UFlowSubsystem::GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+{
+	TSet<AActor*> Result;
+	ForEachComponent(Tag, bExactMatch, [&Result, &ActorClass](UFlowComponent* Component)
+	{
+		if (Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		{
+			Result.Emplace(Component->GetOwner());
+		}
+		return true;
+	});
+
+	return Result;
+}
+
+TSet<AActor*> UFlowSubsystem::GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+{
+	TSet<AActor*> Result;
+	ForEachComponent(Tags, MatchType, bExactMatch, [&Result, &ActorClass](UFlowComponent* Component)
+	{
+		if (Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		{
+			Result.Emplace(Component->GetOwner());
+		}
+		return true;
+	});
+
+	return Result;
+}
+
+TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+{
+	TMap<AActor*, UFlowComponent*> Result;
+	ForEachComponent(Tag, bExactMatch, [&Result, &ActorClass](UFlowComponent* Component)
+	{
+		if (Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		{
+			Result.Emplace(Component->GetOwner(), Component);
+		}
+		return true;
+	});
+
+	return Result;
+}
+
+TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+{
+	TMap<AActor*, UFlowComponent*> Result;
+	ForEachComponent(Tags, MatchType, bExactMatch, [&Result, &ActorClass](UFlowComponent* Component)
+	{
+		if (Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		{
+			Result.Emplace(Component->GetOwner(), Component);
+		}
+		return true;
+	});
+
+	return Result;
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
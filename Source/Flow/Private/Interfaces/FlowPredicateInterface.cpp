@@ -18,3 +18,81 @@ bool IFlowPredicateInterface::ImplementsInterfaceSafe(const UFlowNodeAddOn* AddO
 
 	return false;
 }
+
+bool IFlowPredicateInterface::IsPredicateObservableSafe(const UFlowNodeAddOn* AddOn)
+{
+	// shared templates execute for many Flow Asset instances, so they can't notify about changes of any of them
+	return ImplementsInterfaceSafe(AddOn) && !AddOn->CanShareTemplate() && Execute_IsPredicateObservable(AddOn);
+}
+
+bool FFlowPredicateResultCache::Evaluate(const UFlowNodeAddOn& Predicate)
+{
+	FEntry& Entry = FindOrAddEntry(Predicate);
+	if (Entry.bHasResult)
+	{
+		return Entry.bResult;
+	}
+
+	const bool bResult = IFlowPredicateInterface::Execute_EvaluatePredicate(&Predicate);
+	if (Entry.bObservable)
+	{
+		Entry.bHasResult = true;
+		Entry.bResult = bResult;
+	}
+
+	return bResult;
+}
+
+bool FFlowPredicateResultCache::AreAllObservable(const TArray<UFlowNodeAddOn*>& Predicates)
+{
+	for (const UFlowNodeAddOn* Predicate : Predicates)
+	{
+		if (IFlowPredicateInterface::ImplementsInterfaceSafe(Predicate) && !FindOrAddEntry(*Predicate).bObservable)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FFlowPredicateResultCache::Invalidate(const UFlowNodeAddOn& Predicate)
+{
+	if (FEntry* Entry = Entries.Find(&Predicate))
+	{
+		Entry->bHasResult = false;
+	}
+}
+
+bool FFlowPredicateResultCache::HandleChildChanged(const UFlowNodeAddOn& Predicate, TFunctionRef<bool()> EvaluateAll)
+{
+	Invalidate(Predicate);
+
+	// result wasn't requested yet, so nobody waits for its change
+	if (!LastResult.IsSet())
+	{
+		return false;
+	}
+
+	const bool bPreviousResult = LastResult.GetValue();
+	return EvaluateAll() != bPreviousResult;
+}
+
+void FFlowPredicateResultCache::Reset()
+{
+	Entries.Reset();
+	LastResult.Reset();
+}
+
+FFlowPredicateResultCache::FEntry& FFlowPredicateResultCache::FindOrAddEntry(const UFlowNodeAddOn& Predicate)
+{
+	if (FEntry* Entry = Entries.Find(&Predicate))
+	{
+		return *Entry;
+	}
+
+	// observability doesn't change during the instance lifetime, so it's queried once
+	FEntry& NewEntry = Entries.Add(&Predicate);
+	NewEntry.bObservable = IFlowPredicateInterface::IsPredicateObservableSafe(&Predicate);
+	return NewEntry;
+}
@@ -4,6 +4,7 @@
 #include "MovieScene/MovieSceneFlowTrack.h"
 #include "Nodes/Actor/FlowNode_PlayLevelSequence.h"
 
+#include "Algo/BinarySearch.h"
 #include "Evaluation/MovieSceneEvaluation.h"
 #include "IMovieScenePlayer.h"
 
@@ -13,24 +14,37 @@
 
 DECLARE_CYCLE_STAT(TEXT("Flow Track Token Execute"), MovieSceneEval_FlowTrack_TokenExecute, STATGROUP_MovieSceneEval);
 
+using FFlowTrackEventNames = TArray<FName, TInlineAllocator<4>>;
+
 struct FFlowTrackExecutionToken final : IMovieSceneExecutionToken
 {
-	FFlowTrackExecutionToken(TArray<FString> InEventNames)
+	FFlowTrackExecutionToken(FFlowTrackEventNames&& InEventNames)
 		: EventNames(MoveTemp(InEventNames))
 	{
 	}
 
-	TArray<FString> EventNames;
+	FFlowTrackEventNames EventNames;
 
 	virtual void Execute(const FMovieSceneContext& Context, const FMovieSceneEvaluationOperand& Operand, FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) override
 	{
 		MOVIESCENE_DETAILED_SCOPE_CYCLE_COUNTER(MovieSceneEval_FlowTrack_TokenExecute)
 
-		for (const FString& EventName : EventNames)
+		// resolve receivers once, not for every event
+		TArray<TWeakObjectPtr<UFlowNode_PlayLevelSequence>, TInlineAllocator<2>> FlowNodes;
+		for (UObject* EventReceiver : Player.GetEventContexts())
+		{
+			if (UFlowNode_PlayLevelSequence* FlowNode = Cast<UFlowNode_PlayLevelSequence>(EventReceiver))
+			{
+				FlowNodes.Add(FlowNode);
+			}
+		}
+
+		for (const FName& EventName : EventNames)
 		{
-			for (UObject* EventReceiver : Player.GetEventContexts())
+			for (const TWeakObjectPtr<UFlowNode_PlayLevelSequence>& FlowNode : FlowNodes)
 			{
-				if (UFlowNode_PlayLevelSequence* FlowNode = Cast<UFlowNode_PlayLevelSequence>(EventReceiver))
+				// triggered output might stop the sequence and finish the node
+				if (FlowNode.IsValid())
 				{
 					FlowNode->TriggerEvent(EventName);
 				}
@@ -49,10 +63,15 @@ FMovieSceneFlowTriggerTemplate::FMovieSceneFlowTriggerTemplate(const UMovieScene
 	EventTimes.Reserve(Times.Num());
 	EventNames.Reserve(Times.Num());
 
+	// channel keeps keys sorted by time, so templates stay sorted without extra work
 	for (int32 Index = 0; Index < Times.Num(); ++Index)
 	{
-		EventTimes.Add(Times[Index]);
-		EventNames.Add(EntryPoints[Index]);
+		if (!EntryPoints[Index].IsEmpty())
+		{
+			checkSlow(EventTimes.Num() == 0 || EventTimes.Last() <= Times[Index]);
+			EventTimes.Add(Times[Index]);
+			EventNames.Add(FName(*EntryPoints[Index]));
+		}
 	}
 }
 
@@ -73,42 +92,61 @@ void FMovieSceneFlowTriggerTemplate::EvaluateSwept(const FMovieSceneEvaluationOp
 		return;
 	}
 
-	TArray<FString> EventsToTrigger;
+	// find keys within the swept range by bisecting sorted times, instead of testing every key
+	const TRangeBound<FFrameNumber> LowerBound = SweptRange.GetLowerBound();
+	const TRangeBound<FFrameNumber> UpperBound = SweptRange.GetUpperBound();
+
+	int32 FirstIndex = 0;
+	if (LowerBound.IsInclusive())
+	{
+		FirstIndex = Algo::LowerBound(EventTimes, LowerBound.GetValue());
+	}
+	else if (LowerBound.IsExclusive())
+	{
+		FirstIndex = Algo::UpperBound(EventTimes, LowerBound.GetValue());
+	}
+
+	int32 EndIndex = EventTimes.Num();
+	if (UpperBound.IsInclusive())
+	{
+		EndIndex = Algo::UpperBound(EventTimes, UpperBound.GetValue());
+	}
+	else if (UpperBound.IsExclusive())
+	{
+		EndIndex = Algo::LowerBound(EventTimes, UpperBound.GetValue());
+	}
+
+	if (FirstIndex >= EndIndex)
+	{
+		return;
+	}
+
+	FFlowTrackEventNames EventsToTrigger;
+	EventsToTrigger.Reserve(EndIndex - FirstIndex);
 
 	if (bBackwards)
 	{
 		// Trigger events backwards
-		for (int32 KeyIndex = EventTimes.Num() - 1; KeyIndex >= 0; --KeyIndex)
+		for (int32 KeyIndex = EndIndex - 1; KeyIndex >= FirstIndex; --KeyIndex)
 		{
-			FFrameNumber Time = EventTimes[KeyIndex];
-			if (!EventNames[KeyIndex].IsEmpty() && SweptRange.Contains(Time))
-			{
-				EventsToTrigger.Add(EventNames[KeyIndex]);
-			}
+			EventsToTrigger.Add(EventNames[KeyIndex]);
 		}
 	}
 	else
 	{
 		// Trigger events forwards
-		for (int32 KeyIndex = 0; KeyIndex < EventTimes.Num(); ++KeyIndex)
+		for (int32 KeyIndex = FirstIndex; KeyIndex < EndIndex; ++KeyIndex)
 		{
-			FFrameNumber Time = EventTimes[KeyIndex];
-			if (!EventNames[KeyIndex].IsEmpty() && SweptRange.Contains(Time))
-			{
-				EventsToTrigger.Add(EventNames[KeyIndex]);
-			}
+			EventsToTrigger.Add(EventNames[KeyIndex]);
 		}
 	}
 
-	if (EventsToTrigger.Num())
-	{
-		ExecutionTokens.Add(FFlowTrackExecutionToken(MoveTemp(EventsToTrigger)));
-	}
+	ExecutionTokens.Add(FFlowTrackExecutionToken(MoveTemp(EventsToTrigger)));
 }
 
 FMovieSceneFlowRepeaterTemplate::FMovieSceneFlowRepeaterTemplate(const UMovieSceneFlowRepeaterSection& Section, const UMovieSceneFlowTrack& Track)
 	: FMovieSceneFlowTemplateBase(Track, Section)
-	, EventName(Section.EventName)
+	, EventName(Section.EventName.IsEmpty() ? NAME_None : FName(*Section.EventName))
 {
 }
 
@@ -120,14 +158,16 @@ void FMovieSceneFlowRepeaterTemplate::EvaluateSwept(const FMovieSceneEvaluationO
 	// Don't allow events to fire when playback is in a stopped state. This can occur when stopping 
 	// playback and returning the current position to the start of playback. It's not desirable to have 
 	// all the events from the last playback position to the start of playback be fired.
-	if (EventName.IsEmpty() || !SweptRange.Contains(CurrentFrame) || Context.GetStatus() == EMovieScenePlayerStatus::Stopped || Context.IsSilent())
+	if (EventName.IsNone() || !SweptRange.Contains(CurrentFrame) || Context.GetStatus() == EMovieScenePlayerStatus::Stopped || Context.IsSilent())
 	{
 		return;
 	}
 
 	if ((!bBackwards && bFireEventsWhenForwards) || (bBackwards && bFireEventsWhenBackwards))
 	{
-		ExecutionTokens.Add(FFlowTrackExecutionToken({EventName}));
+		FFlowTrackEventNames EventsToTrigger;
+		EventsToTrigger.Add(EventName);
+		ExecutionTokens.Add(FFlowTrackExecutionToken(MoveTemp(EventsToTrigger)));
 	}
 }
 
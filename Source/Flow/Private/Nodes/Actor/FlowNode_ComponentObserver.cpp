@@ -56,8 +56,17 @@ void UFlowNode_ComponentObserver::StartObserving()
 		const bool bExactMatch = (IdentityMatchType == EFlowTagContainerMatchType::HasAnyExact || IdentityMatchType == EFlowTagContainerMatchType::HasAllExact);
 
 		// collect already registered components
-		for (const TWeakObjectPtr<UFlowComponent>& FoundComponent : FlowSubsystem->GetComponents<UFlowComponent>(IdentityTags, ContainerMatchType, bExactMatch))
+		// observing actor might trigger outputs and change the registry, so we can't iterate the registry directly
+		TArray<TWeakObjectPtr<UFlowComponent>, TInlineAllocator<8>> FoundComponents;
+		FlowSubsystem->GetComponents(IdentityTags, ContainerMatchType, FoundComponents, bExactMatch);
+
+		for (const TWeakObjectPtr<UFlowComponent>& FoundComponent : FoundComponents)
 		{
+			if (!FoundComponent.IsValid())
+			{
+				continue;
+			}
+
 			ObserveActor(FoundComponent->GetOwner(), FoundComponent);
 			
 			// node might finish work immediately as the effect of ObserveActor()
@@ -68,10 +77,17 @@ void UFlowNode_ComponentObserver::StartObserving()
 			}
 		}
 		
-		FlowSubsystem->OnComponentRegistered.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentRegistered);
-		FlowSubsystem->OnComponentTagAdded.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentTagAdded);
-		FlowSubsystem->OnComponentTagRemoved.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentTagRemoved);
-		FlowSubsystem->OnComponentUnregistered.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentUnregistered);
+		if (!ComponentObserverHandle.IsValid())
+		{
+			// subsystem calls us only for components which Identity Tags can match our tags
+			FFlowComponentObserver Observer(IdentityTags, IdentityMatchType);
+			Observer.OnComponentRegistered.BindUObject(this, &UFlowNode_ComponentObserver::OnComponentRegistered);
+			Observer.OnComponentTagAdded.BindUObject(this, &UFlowNode_ComponentObserver::OnComponentTagAdded);
+			Observer.OnComponentTagRemoved.BindUObject(this, &UFlowNode_ComponentObserver::OnComponentTagRemoved);
+			Observer.OnComponentUnregistered.BindUObject(this, &UFlowNode_ComponentObserver::OnComponentUnregistered);
+
+			ComponentObserverHandle = FlowSubsystem->AddComponentObserver(Observer);
+		}
 	}
 }
 
@@ -79,11 +95,10 @@ void UFlowNode_ComponentObserver::StopObserving()
 {
 	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 	{
-		FlowSubsystem->OnComponentRegistered.RemoveAll(this);
-		FlowSubsystem->OnComponentUnregistered.RemoveAll(this);
-		FlowSubsystem->OnComponentTagAdded.RemoveAll(this);
-		FlowSubsystem->OnComponentTagRemoved.RemoveAll(this);
+		FlowSubsystem->RemoveComponentObserver(ComponentObserverHandle);
 	}
+
+	ComponentObserverHandle.Reset();
 }
 
 void UFlowNode_ComponentObserver::OnComponentRegistered(UFlowComponent* Component)
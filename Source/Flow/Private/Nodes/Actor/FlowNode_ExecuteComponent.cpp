@@ -281,7 +281,7 @@ TArray<FFlowPin> UFlowNode_ExecuteComponent::GetContextOutputs() const
 
 #endif // WITH_EDITOR
 
-void UFlowNode_ExecuteComponent::GatherPotentialPropertyOwnersForDataPins(TArray<const UObject*>& InOutOwners) const
+void UFlowNode_ExecuteComponent::GatherPotentialPropertyOwnersForDataPins(TFlowPropertyOwnerArray& InOutOwners) const
 {
 	Super::GatherPotentialPropertyOwnersForDataPins(InOutOwners);
 
@@ -24,9 +24,16 @@ void UFlowNode_NotifyActor::ExecuteInput(const FName& PinName)
 {
 	if (const UFlowSubsystem* FlowSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UFlowSubsystem>())
 	{
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(IdentityTags, MatchType, bExactMatch))
+		// collect components first, as receiving notify might change Identity Tags of components
+		TArray<TWeakObjectPtr<UFlowComponent>, TInlineAllocator<8>> FoundComponents;
+		FlowSubsystem->GetComponents(IdentityTags, MatchType, FoundComponents, bExactMatch);
+
+		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
 		{
-			Component->NotifyFromGraph(NotifyTags, NetMode);
+			if (Component.IsValid())
+			{
+				Component->NotifyFromGraph(NotifyTags, NetMode);
+			}
 		}
 	}
 
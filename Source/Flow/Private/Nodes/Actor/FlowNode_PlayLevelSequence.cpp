@@ -210,6 +210,12 @@ void UFlowNode_PlayLevelSequence::ExecuteInput(const FName& PinName)
 	}
 }
 
+bool UFlowNode_PlayLevelSequence::IsSaveDirty() const
+{
+	// elapsed time is read from the player in OnSave
+	return Super::IsSaveDirty() || SequencePlayer != nullptr;
+}
+
 void UFlowNode_PlayLevelSequence::OnSave_Implementation()
 {
 	if (SequencePlayer)
@@ -249,9 +255,9 @@ void UFlowNode_PlayLevelSequence::OnLoad_Implementation()
 	}
 }
 
-void UFlowNode_PlayLevelSequence::TriggerEvent(const FString& EventName)
+void UFlowNode_PlayLevelSequence::TriggerEvent(const FName& EventName)
 {
-	TriggerOutput(*EventName, false);
+	TriggerOutput(EventName, false);
 }
 
 void UFlowNode_PlayLevelSequence::OnTimeDilationUpdate(const float NewTimeDilation)
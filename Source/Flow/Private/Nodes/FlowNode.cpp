@@ -6,9 +6,12 @@
 #include "FlowAsset.h"
 #include "FlowSettings.h"
 #include "Interfaces/FlowNodeWithExternalDataPinSupplierInterface.h"
+#include "Trace/FlowStats.h"
+#include "Trace/FlowTrace.h"
 #include "Types/FlowPinType.h"
 #include "Types/FlowDataPinValue.h"
 #include "Types/FlowAutoDataPinsWorkingData.h"
+#include "Types/FlowPinPropertyCache.h"
 
 #include "Components/ActorComponent.h"
 #if WITH_EDITOR
@@ -18,8 +21,7 @@
 #include "Engine/BlueprintGeneratedClass.h"
 #include "GameFramework/Actor.h"
 #include "Misc/App.h"
-#include "Serialization/MemoryReader.h"
-#include "Serialization/MemoryWriter.h"
+#include "UObject/UnrealType.h"
 
 FFlowPin UFlowNode::DefaultInputPin(TEXT("In"));
 FFlowPin UFlowNode::DefaultOutputPin(TEXT("Out"));
@@ -481,16 +483,19 @@ bool UFlowNode::TryFindPropertyByPinName_Static(
 	TInstancedStruct<FFlowDataPinValue>& OutFoundInstancedStruct)
 {
 	// Try direct property match
-	OutFoundProperty = PropertyOwnerObject.GetClass()->FindPropertyByName(PinName);
+	const FFlowCachedPinProperty CachedProperty = FFlowPinPropertyCache::FindProperty(*PropertyOwnerObject.GetClass(), PinName);
+	OutFoundProperty = CachedProperty.Property;
 	if (OutFoundProperty)
 	{
-		const FStructProperty* StructProperty = CastField<FStructProperty>(OutFoundProperty);
-		if (StructProperty && StructProperty->Struct->IsChildOf(FFlowDataPinValue::StaticStruct()))
+		if (CachedProperty.DataPinValueStruct)
 		{
-			// Initialize to match property's struct
-			OutFoundInstancedStruct.InitializeAsScriptStruct(StructProperty->Struct);
+			// Reuse the memory, if the struct was already initialized to match property's struct
+			if (OutFoundInstancedStruct.GetScriptStruct() != CachedProperty.DataPinValueStruct)
+			{
+				OutFoundInstancedStruct.InitializeAsScriptStruct(CachedProperty.DataPinValueStruct);
+			}
 
-			StructProperty->GetValue_InContainer(&PropertyOwnerObject, OutFoundInstancedStruct.GetMutableMemory());
+			CachedProperty.DataPinValueStruct->CopyScriptStruct(OutFoundInstancedStruct.GetMutableMemory(), CachedProperty.GetValuePtr(PropertyOwnerObject));
 			return true;
 		}
 
@@ -501,11 +506,45 @@ bool UFlowNode::TryFindPropertyByPinName_Static(
 	return false;
 }
 
-void UFlowNode::GatherPotentialPropertyOwnersForDataPins(TArray<const UObject*>& InOutOwners) const
+bool UFlowNode::TryFindDataPinValueSourceByPinName(
+	const UObject& PropertyOwnerObject,
+	const FName& PinName,
+	FFlowDataPinValueSource& OutSource) const
+{
+	const FFlowCachedPinProperty CachedProperty = FFlowPinPropertyCache::FindProperty(*PropertyOwnerObject.GetClass(), PinName);
+	if (!CachedProperty.IsValid())
+	{
+		return false;
+	}
+
+	if (CachedProperty.DataPinValueStruct)
+	{
+		OutSource.DataPinValue = static_cast<const FFlowDataPinValue*>(CachedProperty.GetValuePtr(PropertyOwnerObject));
+	}
+	else
+	{
+		OutSource.Property = CachedProperty.Property;
+		OutSource.Container = &PropertyOwnerObject;
+	}
+
+	return true;
+}
+
+void UFlowNode::GatherPotentialPropertyOwnersForDataPins(TFlowPropertyOwnerArray& InOutOwners) const
 {
 	// TODO (gtaylor) Also add any AddOns that can supply data pins, when/if we want to add AddOn data pin supply support
 
 	InOutOwners.AddUnique(this);
+
+	// deprecated overload adds nothing unless overridden, so the array allocates only for legacy overrides
+	TArray<const UObject*> LegacyOwners;
+PRAGMA_DISABLE_DEPRECATION_WARNINGS
+	GatherPotentialPropertyOwnersForDataPins(LegacyOwners);
+PRAGMA_ENABLE_DEPRECATION_WARNINGS
+	for (const UObject* LegacyOwner : LegacyOwners)
+	{
+		InOutOwners.AddUnique(LegacyOwner);
+	}
 }
 
 FFlowDataPinResult UFlowNode::TrySupplyDataPin_Implementation(FName PinName) const
@@ -536,6 +575,51 @@ FFlowDataPinResult UFlowNode::TrySupplyDataPin_Implementation(FName PinName) con
 	return FFlowDataPinResult(EFlowDataPinResolveResult::FailedUnknownPin);
 }
 
+EFlowDataPinResolveResult UFlowNode::TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const
+{
+	// native overrides of TrySupplyDataPin can't be detected, so classes opt in, Blueprint override can't be mirrored by the typed path
+	const UClass* NodeClass = GetClass();
+	if (!SupportsTypedDataPinSupply()
+		|| (!NodeClass->IsNative() && NodeClass->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IFlowDataPinValueSupplierInterface, TrySupplyDataPin))))
+	{
+		return EFlowDataPinResolveResult::FailedUnimplemented;
+	}
+
+	const FFlowPin* FlowPin = FindOutputPinByName(PinName);
+	if (!FlowPin)
+	{
+		// Also look in the Input Pins (for supplying default values for unconnected pins)
+		FlowPin = FindInputPinByName(PinName);
+		if (!FlowPin)
+		{
+			return EFlowDataPinResolveResult::FailedUnknownPin;
+		}
+	}
+
+	// Converting between pin types is left to TrySupplyDataPin
+	if (!(FlowPin->GetPinTypeName() == Request.PinTypeName))
+	{
+		return EFlowDataPinResolveResult::FailedMismatchedType;
+	}
+
+	TFlowPropertyOwnerArray PropertyOwnerObjects;
+	GatherPotentialPropertyOwnersForDataPins(PropertyOwnerObjects);
+
+	for (const UObject* PropertyOwnerObject : PropertyOwnerObjects)
+	{
+		checkf(IsValid(PropertyOwnerObject), TEXT("Every UObject provided by GatherPotentialPropertyOwnersForDataPins must be valid"));
+
+		FFlowDataPinValueSource Source;
+		if (TryFindDataPinValueSourceByPinName(*PropertyOwnerObject, PinName, Source))
+		{
+			// TrySupplyDataPin could still succeed on the next owner, if this one fails, so caller will fall back to it
+			return Request.CopyValue(Source);
+		}
+	}
+
+	return EFlowDataPinResolveResult::FailedUnknownPin;
+}
+
 bool UFlowNode::TryGatherPropertyOwnersAndPopulateResult(
 	const FName& PinName,
 	const FFlowPinType& DataPinType,
@@ -543,7 +627,7 @@ bool UFlowNode::TryGatherPropertyOwnersAndPopulateResult(
 	FFlowDataPinResult& OutSuppliedResult) const
 {
 	// Gather all of the potential providers for this DataPin
-	TArray<const UObject*> PropertyOwnerObjects;
+	TFlowPropertyOwnerArray PropertyOwnerObjects;
 	GatherPotentialPropertyOwnersForDataPins(PropertyOwnerObjects);
 
 	// Look through all of the potential providers
@@ -623,6 +707,32 @@ bool UFlowNode::TryGetFlowDataPinSupplierDatasForPinName(
 	return !InOutPinValueSupplierDatas.IsEmpty();
 }
 
+bool UFlowNode::TryGetFlowDataPinValueStampsForPinName(
+	const FName& PinName,
+	TFlowPinValueSupplierStampArray& OutPinValueSupplierStamps) const
+{
+	OutPinValueSupplierStamps.Reset();
+
+	TFlowPinValueSupplierDataArray PinValueSupplierDatas;
+	if (!TryGetFlowDataPinSupplierDatasForPinName(PinName, PinValueSupplierDatas))
+	{
+		return false;
+	}
+
+	for (const FFlowPinValueSupplierData& SupplierData : PinValueSupplierDatas)
+	{
+		FFlowPinValueSupplierStamp& SupplierStamp = OutPinValueSupplierStamps.AddDefaulted_GetRef();
+		SupplierStamp.PinValueSupplier = SupplierData.PinValueSupplier;
+
+		if (!SupplierData.PinValueSupplier->TryGetDataPinValueStamp(SupplierData.SupplierPinName, SupplierStamp.Stamp))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 TSet<UFlowNode*> UFlowNode::GatherConnectedNodes() const
 {
 	TSet<UFlowNode*> Result;
@@ -858,45 +968,93 @@ void UFlowNode::TriggerFlush()
 	FlushContent();
 }
 
-void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType ActivationType /*= Default*/)
+void UFlowNode::GatherPrefetchContent(TArray<FSoftObjectPath>& OutPaths) const
 {
-	if (SignalMode == EFlowSignalMode::Disabled)
+	if (!bPrefetchContentGathered)
 	{
-		// entirely ignore any Input activation
-	}
+		bPrefetchContentGathered = true;
 
-	if (InputPins.Contains(PinName))
-	{
-		if (SignalMode == EFlowSignalMode::Enabled)
+		auto GatherSoftReferences = [this](const UObject& Object)
 		{
-			const EFlowNodeState PreviousActivationState = ActivationState;
-			if (PreviousActivationState != EFlowNodeState::Active)
+			for (TPropertyValueIterator<FSoftObjectProperty> It(Object.GetClass(), &Object); It; ++It)
 			{
-				OnActivate();
+				if (It.Key()->HasAnyPropertyFlags(CPF_EditorOnly | CPF_Transient))
+				{
+					continue;
+				}
+
+				const FSoftObjectPath& Path = static_cast<const FSoftObjectPtr*>(It.Value())->ToSoftObjectPath();
+				if (Path.IsValid())
+				{
+					PrefetchContentPaths.AddUnique(Path);
+				}
 			}
+		};
 
-			ActivationState = EFlowNodeState::Active;
-		}
+		GatherSoftReferences(*this);
+		ForEachAddOnConst([&GatherSoftReferences](const UFlowNodeAddOn& AddOn)
+		{
+			GatherSoftReferences(AddOn);
+			return EFlowForEachAddOnFunctionReturnValue::Continue;
+		});
+	}
 
-#if !UE_BUILD_SHIPPING
-		// record for debugging
-		TArray<FPinRecord>& Records = InputRecords.FindOrAdd(PinName);
-		Records.Add(FPinRecord(FApp::GetCurrentTime(), ActivationType));
+	OutPaths.Append(PrefetchContentPaths);
+}
 
-		if (const UFlowAsset* FlowAssetTemplate = GetFlowAsset()->GetTemplateAsset())
-		{
-			(void)FlowAssetTemplate->OnPinTriggered.ExecuteIfBound(NodeGuid, PinName);
-		}
+void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType ActivationType /*= Default*/)
+{
+	const int32 PinIndex = InputPins.IndexOfByKey(PinName);
+	if (PinIndex == INDEX_NONE)
+	{
+#if !UE_BUILD_SHIPPING
+		LogError(FString::Printf(TEXT("Input Pin name %s invalid"), *PinName.ToString()));
 #endif
+		return;
 	}
-#if !UE_BUILD_SHIPPING
-	else
+
+	TriggerInputByIndex(PinIndex, ActivationType);
+}
+
+void UFlowNode::TriggerInputByIndex(const int32 PinIndex, const EFlowPinActivationType ActivationType /*= Default*/)
+{
+	if (SignalMode == EFlowSignalMode::Disabled)
 	{
-		LogError(FString::Printf(TEXT("Input Pin name %s invalid"), *PinName.ToString()));
+		// entirely ignore any Input activation
+	}
+
+	if (!InputPins.IsValidIndex(PinIndex))
+	{
+#if !UE_BUILD_SHIPPING
+		LogError(FString::Printf(TEXT("Input Pin index %d invalid"), PinIndex));
+#endif
 		return;
 	}
+
+	const FName PinName = InputPins[PinIndex].PinName;
+
+	if (SignalMode == EFlowSignalMode::Enabled)
+	{
+		const EFlowNodeState PreviousActivationState = ActivationState;
+		if (PreviousActivationState != EFlowNodeState::Active)
+		{
+			FLOW_NODE_STATS_SCOPE(*this, Activate);
+			OnActivate();
+		}
+
+		ActivationState = EFlowNodeState::Active;
+		MarkSaveDirty();
+	}
+
+#if !UE_BUILD_SHIPPING
+	// record for debugging
+	InputRecords.FindOrAdd(PinName).Add(FPinRecord(FApp::GetCurrentTime(), ActivationType), UFlowSettings::Get()->PinRecordsLimit);
+
+	GetFlowAsset()->BroadcastPinTriggered(NodeGuid, PinName);
 #endif
 
+	FLOW_TRACE_INPUT_SCOPE(*this, PinIndex, ActivationType);
+
 	switch (SignalMode)
 	{
 		case EFlowSignalMode::Enabled:
@@ -941,18 +1099,21 @@ void UFlowNode::TriggerOutput(const FName PinName, const bool bFinish /*= false*
 	{
 		Finish();
 	}
+	else
+	{
+		// outputs are usually triggered after the node changed its state
+		MarkSaveDirty();
+	}
+
+	const int32 OutputPinIndex = OutputPins.IndexOfByKey(PinName);
 
 #if !UE_BUILD_SHIPPING
-	if (OutputPins.Contains(PinName))
+	if (OutputPinIndex != INDEX_NONE)
 	{
 		// record for debugging, even if nothing is connected to this pin
-		TArray<FPinRecord>& Records = OutputRecords.FindOrAdd(PinName);
-		Records.Add(FPinRecord(FApp::GetCurrentTime(), ActivationType));
+		OutputRecords.FindOrAdd(PinName).Add(FPinRecord(FApp::GetCurrentTime(), ActivationType), UFlowSettings::Get()->PinRecordsLimit);
 
-		if (const UFlowAsset* FlowAssetTemplate = GetFlowAsset()->GetTemplateAsset())
-		{
-			FlowAssetTemplate->OnPinTriggered.ExecuteIfBound(NodeGuid, PinName);
-		}
+		GetFlowAsset()->BroadcastPinTriggered(NodeGuid, PinName);
 	}
 	else
 	{
@@ -961,10 +1122,10 @@ void UFlowNode::TriggerOutput(const FName PinName, const bool bFinish /*= false*
 #endif
 
 	// call the next node
-	if (OutputPins.Contains(PinName) && Connections.Contains(PinName))
+	if (OutputPinIndex != INDEX_NONE)
 	{
-		const FConnectedPin FlowPin = GetConnection(PinName);
-		GetFlowAsset()->TriggerInput(FlowPin.NodeGuid, FlowPin.PinName, FConnectedPin(GetGuid(), PinName));
+		FLOW_TRACE_OUTPUT_TRIGGERED(*this, OutputPinIndex, ActivationType);
+		GetFlowAsset()->PropagateOutput(*this, OutputPinIndex);
 	}
 }
 
@@ -991,12 +1152,37 @@ void UFlowNode::Deactivate()
 		ActivationState = EFlowNodeState::Completed;
 	}
 
+	MarkSaveDirty();
+
+	FLOW_NODE_STATS_SCOPE(*this, Cleanup);
 	Cleanup();
 }
 
+void UFlowNode::ResetInstance(const UFlowNodeBase& Template)
+{
+	Super::ResetInstance(Template);
+
+	bPreloaded = false;
+	CachedSaveData.Empty();
+	ResetRecords();
+}
+
+void UFlowNode::SwapInstanceState(FFlowNodeInstanceState& InstanceState)
+{
+	Swap(bPreloaded, InstanceState.bPreloaded);
+	Swap(bSaveDirty, InstanceState.bSaveDirty);
+	Swap(CachedSaveData, InstanceState.CachedSaveData);
+
+#if !UE_BUILD_SHIPPING
+	Swap(InputRecords, InstanceState.InputRecords);
+	Swap(OutputRecords, InstanceState.OutputRecords);
+#endif
+}
+
 void UFlowNode::ResetRecords()
 {
 	ActivationState = EFlowNodeState::NeverActivated;
+	MarkSaveDirty();
 
 #if !UE_BUILD_SHIPPING
 	InputRecords.Empty();
@@ -1006,19 +1192,36 @@ void UFlowNode::ResetRecords()
 
 void UFlowNode::SaveInstance(FFlowNodeSaveData& NodeRecord)
 {
+	FLOW_NODE_STATS_SCOPE(*this, Save);
+
 	NodeRecord.NodeGuid = NodeGuid;
+
+	const bool bIncrementalSave = UFlowSettings::Get()->bIncrementalSaveData;
+	if (bIncrementalSave && !IsSaveDirty())
+	{
+		NodeRecord.NodeData = CachedSaveData;
+		return;
+	}
+
 	OnSave();
 
-	FMemoryWriter MemoryWriter(NodeRecord.NodeData, true);
-	FFlowArchive Ar(MemoryWriter);
-	Serialize(Ar);
+	FlowSave::SaveObject(*this, NodeRecord.NodeData);
+
+	if (bIncrementalSave)
+	{
+		CachedSaveData = NodeRecord.NodeData;
+		bSaveDirty = false;
+	}
 }
 
 void UFlowNode::LoadInstance(const FFlowNodeSaveData& NodeRecord)
 {
-	FMemoryReader MemoryReader(NodeRecord.NodeData, true);
-	FFlowArchive Ar(MemoryReader);
-	Serialize(Ar);
+	FLOW_NODE_STATS_SCOPE(*this, Load);
+
+	FlowSave::LoadObject(*this, NodeRecord.NodeData);
+
+	// OnLoad might change the loaded state, so the record can't be reused as the cache
+	MarkSaveDirty();
 
 	if (UFlowAsset* FlowAsset = GetFlowAsset())
 	{
@@ -1043,6 +1246,17 @@ void UFlowNode::LoadInstance(const FFlowNodeSaveData& NodeRecord)
 	}
 }
 
+void UFlowNode::MarkSaveDirty()
+{
+	bSaveDirty = true;
+}
+
+bool UFlowNode::IsSaveDirty() const
+{
+	// we can't tell what Blueprint collects in OnSave
+	return bSaveDirty || GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UFlowNode, OnSave));
+}
+
 void UFlowNode::OnSave_Implementation()
 {
 }
@@ -1071,7 +1285,7 @@ void UFlowNode::OnPassThrough_Implementation()
 TMap<uint8, FPinRecord> UFlowNode::GetWireRecords() const
 {
 	TMap<uint8, FPinRecord> Result;
-	for (const TPair<FName, TArray<FPinRecord>>& Record : OutputRecords)
+	for (const TPair<FName, FPinRecordHistory>& Record : OutputRecords)
 	{
 		Result.Emplace(OutputPins.IndexOfByKey(Record.Key), Record.Value.Last());
 	}
@@ -1079,22 +1293,28 @@ TMap<uint8, FPinRecord> UFlowNode::GetWireRecords() const
 }
 
 TArray<FPinRecord> UFlowNode::GetPinRecords(const FName& PinName, const EEdGraphPinDirection PinDirection) const
+{
+	const FPinRecordHistory* PinRecords = FindPinRecordHistory(PinName, PinDirection);
+	return PinRecords ? PinRecords->ToArray() : TArray<FPinRecord>();
+}
+
+const FPinRecordHistory* UFlowNode::FindPinRecordHistory(const FName& PinName, const EEdGraphPinDirection PinDirection) const
 {
 	switch (PinDirection)
 	{
 		case EGPD_Input:
-			return InputRecords.FindRef(PinName);
+			return InputRecords.Find(PinName);
 		case EGPD_Output:
-			return OutputRecords.FindRef(PinName);
+			return OutputRecords.Find(PinName);
 		default:
-			return TArray<FPinRecord>();
+			return nullptr;
 	}
 }
 
 void UFlowNode::AutoGenerateDataPins(FFlowAutoDataPinsWorkingData& InOutWorkingData) const
 {
 	// Gather all of the potential providers for this DataPin
-	TArray<const UObject*> PropertyOwnerObjects;
+	TFlowPropertyOwnerArray PropertyOwnerObjects;
 	GatherPotentialPropertyOwnersForDataPins(PropertyOwnerObjects);
 
 	// GenerateDataPins for all of the potential providers
@@ -9,6 +9,7 @@
 #include "AddOns/FlowNodeAddOn.h"
 #include "Interfaces/FlowDataPinValueSupplierInterface.h"
 #include "Interfaces/FlowNamedPropertiesSupplierInterface.h"
+#include "Trace/FlowStats.h"
 #include "Types/FlowArray.h"
 #include "Types/FlowDataPinResults.h"
 #include "Types/FlowPinTypesStandard.h"
@@ -28,6 +29,7 @@
 #include "Misc/Paths.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
+#include "TimerManager.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNodeBase)
 
@@ -70,7 +72,16 @@ void UFlowNodeBase::InitializeInstance()
 {
 	IFlowCoreExecutableInterface::InitializeInstance();
 
-	if (!AddOns.IsEmpty())
+	if (bPooledInstance)
+	{
+		bPooledInstance = false;
+
+		for (UFlowNodeAddOn* AddOn : AddOns)
+		{
+			AddOn->InitializeInstance();
+		}
+	}
+	else if (!AddOns.IsEmpty())
 	{
 		TArray<UFlowNodeAddOn*> SourceAddOns = AddOns;
 		AddOns.Reset();
@@ -107,6 +118,70 @@ void UFlowNodeBase::DeinitializeInstance()
 	IFlowCoreExecutableInterface::DeinitializeInstance();
 }
 
+bool UFlowNodeBase::CanBePooled() const
+{
+	for (const UFlowNodeAddOn* AddOn : AddOns)
+	{
+		if (!AddOn->CanBePooled())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool UFlowNodeBase::CanShareTemplate() const
+{
+	// Blueprint subclasses might keep state in variables or latent actions
+	if (!bSharedTemplate || !GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		return false;
+	}
+
+	for (const UFlowNodeAddOn* AddOn : AddOns)
+	{
+		if (!IsValid(AddOn) || !AddOn->CanShareTemplate())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UFlowNodeBase::ResetInstance(const UFlowNodeBase& Template)
+{
+	check(GetClass() == Template.GetClass());
+
+	if (UWorld* World = GetWorld())
+	{
+		// latent actions and timers of the finished instance shouldn't fire on the reused one
+		World->GetLatentActionManager().RemoveActionsForObject(this);
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		if (!It->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference))
+		{
+			It->CopyCompleteValue_InContainer(this, &Template);
+		}
+	}
+
+	// AddOn instances were created from valid template AddOns, in the same order
+	int32 AddOnIndex = 0;
+	for (const UFlowNodeAddOn* TemplateAddOn : Template.AddOns)
+	{
+		if (IsValid(TemplateAddOn) && AddOns.IsValidIndex(AddOnIndex))
+		{
+			AddOns[AddOnIndex++]->ResetInstance(*TemplateAddOn);
+		}
+	}
+
+	bPooledInstance = true;
+}
+
 void UFlowNodeBase::PreloadContent()
 {
 	IFlowCoreExecutableInterface::PreloadContent();
@@ -133,6 +208,7 @@ void UFlowNodeBase::OnActivate()
 
 	for (UFlowNodeAddOn* AddOn : AddOns)
 	{
+		FLOW_NODE_STATS_SCOPE(*AddOn, Activate);
 		AddOn->OnActivate();
 	}
 }
@@ -145,6 +221,7 @@ void UFlowNodeBase::ExecuteInputForSelfAndAddOns(const FName& PinName)
 
 	if (IsSupportedInputPinName(PinName))
 	{
+		FLOW_NODE_STATS_SCOPE(*this, ExecuteInput);
 		ExecuteInput(PinName);
 	}
 
@@ -173,6 +250,7 @@ void UFlowNodeBase::Cleanup()
 {
 	for (UFlowNodeAddOn* AddOn : AddOns)
 	{
+		FLOW_NODE_STATS_SCOPE(*AddOn, Cleanup);
 		AddOn->Cleanup();
 	}
 
@@ -274,6 +352,13 @@ UFlowAsset* UFlowNodeBase::GetFlowAsset() const
 {
 	// In the case of an AddOn, we want our containing FlowNode's Outer, not our own
 	const UFlowNode* FlowNode = GetFlowNodeSelfOrOwner();
+
+	// shared template node executes for the instance that swapped its state in
+	if (FlowNode && FlowNode->SharedExecutionInstance)
+	{
+		return FlowNode->SharedExecutionInstance;
+	}
+
 	return FlowNode && FlowNode->GetOuter() ? Cast<UFlowAsset>(FlowNode->GetOuter()) : Cast<UFlowAsset>(GetOuter());
 }
 
@@ -958,6 +1043,8 @@ bool UFlowNodeBase::TryAddValueToFormatNamedArguments(const FFlowNamedDataPinPro
 
 FFlowDataPinResult UFlowNodeBase::TryResolveDataPin(FName PinName) const
 {
+	FLOW_NODE_STATS_SCOPE(*this, ResolveDataPin);
+
 	FFlowDataPinResult DataPinResult(EFlowDataPinResolveResult::Success);
 
 	const UFlowNode* FlowNode = GetFlowNodeSelfOrOwner();
@@ -989,6 +1076,38 @@ FFlowDataPinResult UFlowNodeBase::TryResolveDataPin(FName PinName) const
 	return DataPinResult;
 }
 
+EFlowDataPinResolveResult UFlowNodeBase::TryResolveDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const
+{
+	FLOW_NODE_STATS_SCOPE(*this, ResolveDataPin);
+
+	const UFlowNode* FlowNode = GetFlowNodeSelfOrOwner();
+	UFlowNode::TFlowPinValueSupplierDataArray PinValueSupplierDatas;
+	if (!FlowNode->TryGetFlowDataPinSupplierDatasForPinName(PinName, PinValueSupplierDatas))
+	{
+		// Error is reported by the TryResolveDataPin fallback
+		return EFlowDataPinResolveResult::FailedWithError;
+	}
+
+	EFlowDataPinResolveResult Result = EFlowDataPinResolveResult::FailedUnknownPin;
+
+	// Iterate over the suppliers in inverse order, same as TryResolveDataPin
+	for (int32 Index = PinValueSupplierDatas.Num() - 1; Index >= 0; --Index)
+	{
+		const FFlowPinValueSupplierData& SupplierData = PinValueSupplierDatas[Index];
+
+		Result = SupplierData.PinValueSupplier->TrySupplyDataPinTyped(SupplierData.SupplierPinName, Request);
+
+		// Only an unknown pin lets us move to the next supplier, as TryResolveDataPin would do the same.
+		// Other failures might still succeed on TryResolveDataPin with this supplier (i.e. via type conversion)
+		if (Result != EFlowDataPinResolveResult::FailedUnknownPin)
+		{
+			return Result;
+		}
+	}
+
+	return Result;
+}
+
 // #FlowDataPinLegacy
 FFlowDataPinResult_Bool UFlowNodeBase::TryResolveDataPinAsBool(const FName& PinName) const
 {
@@ -4,6 +4,7 @@
 #include "FlowLogChannels.h"
 
 #include "GameplayTagContainer.h"
+#include "Misc/App.h"
 #include "Misc/DateTime.h"
 #include "Misc/MessageDialog.h"
 #include "StructUtils/InstancedStruct.h"
@@ -25,7 +26,6 @@ FString FPinRecord::PassThroughActivation = TEXT(" (pass-through activation)");
 
 FPinRecord::FPinRecord()
 	: Time(0.0f)
-	, HumanReadableTime(FString())
 	, ActivationType(EFlowPinActivationType::Default)
 {
 }
@@ -34,16 +34,53 @@ FPinRecord::FPinRecord(const double InTime, const EFlowPinActivationType InActiv
 	: Time(InTime)
 	, ActivationType(InActivationType)
 {
-	const FDateTime SystemTime(FDateTime::Now());
-	HumanReadableTime = DoubleDigit(SystemTime.GetHour()) + TEXT(".")
-		+ DoubleDigit(SystemTime.GetMinute()) + TEXT(".")
-		+ DoubleDigit(SystemTime.GetSecond()) + TEXT(":")
-		+ DoubleDigit(SystemTime.GetMillisecond()).Left(3);
 }
 
-FORCEINLINE FString FPinRecord::DoubleDigit(const int32 Number)
+FString FPinRecord::GetHumanReadableTime() const
 {
-	return Number > 9 ? FString::FromInt(Number) : TEXT("0") + FString::FromInt(Number);
+	const FDateTime SystemTime = FDateTime::Now() - FTimespan::FromSeconds(FMath::Max(0.0, FApp::GetCurrentTime() - Time));
+	return FString::Printf(TEXT("%02d.%02d.%02d:%02d"), SystemTime.GetHour(), SystemTime.GetMinute(), SystemTime.GetSecond(), SystemTime.GetMillisecond());
+}
+
+void FPinRecordHistory::Add(const FPinRecord& Record, const int32 Capacity)
+{
+	const int32 MaxRecords = FMath::Max(1, Capacity);
+	TotalNum++;
+
+	// limit changed after the buffer wrapped around
+	if (Head != 0 && Records.Num() != MaxRecords)
+	{
+		Records = ToArray();
+		Head = 0;
+	}
+
+	if (Records.Num() > MaxRecords)
+	{
+		Records.RemoveAt(0, Records.Num() - MaxRecords);
+	}
+
+	if (Records.Num() < MaxRecords)
+	{
+		Records.Add(Record);
+	}
+	else
+	{
+		Records[Head] = Record;
+		Head = (Head + 1) % MaxRecords;
+	}
+}
+
+TArray<FPinRecord> FPinRecordHistory::ToArray() const
+{
+	TArray<FPinRecord> Result;
+	Result.Reserve(Records.Num());
+
+	for (int32 Index = 0; Index < Records.Num(); Index++)
+	{
+		Result.Add((*this)[Index]);
+	}
+
+	return Result;
 }
 #endif
 
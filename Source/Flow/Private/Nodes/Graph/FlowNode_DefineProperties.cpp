@@ -5,6 +5,8 @@
 #include "Types/FlowPinTypesStandard.h"
 #include "Types/FlowDataPinValuesStandard.h"
 
+#include "Internationalization/TextLocalizationManager.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_DefineProperties)
 
 UFlowNode_DefineProperties::UFlowNode_DefineProperties(const FObjectInitializer& ObjectInitializer)
@@ -36,6 +38,40 @@ void UFlowNode_DefineProperties::PostLoad()
 	}
 }
 
+void FFlowNamedPropertiesFormatCache::Reset()
+{
+	Format = FTextFormat();
+	Arguments.Reset();
+	ArgumentStamps.Reset();
+	CachedArguments.Reset();
+	FormattedText = FText::GetEmpty();
+	bFormatCompiled = false;
+	bFormatted = false;
+}
+
+void UFlowNode_DefineProperties::ResetInstance(const UFlowNodeBase& Template)
+{
+	Super::ResetInstance(Template);
+
+	// values cached by consumers of this node belong to the previous instance
+	MarkNamedPropertiesChanged();
+}
+
+bool UFlowNode_DefineProperties::TryGetDataPinValueStamp(const FName& PinName, uint32& OutStamp) const
+{
+	// Named properties are literals, they change only if someone calls MarkNamedPropertiesChanged()
+	for (const FFlowNamedDataPinProperty& NamedProperty : NamedProperties)
+	{
+		if (NamedProperty.Name == PinName && NamedProperty.IsValid())
+		{
+			OutStamp = NamedPropertiesStamp;
+			return true;
+		}
+	}
+
+	return Super::TryGetDataPinValueStamp(PinName, OutStamp);
+}
+
 bool UFlowNode_DefineProperties::TryFindPropertyByPinName(
 	const UObject& PropertyOwnerObject,
 	const FName& PinName,
@@ -57,6 +93,26 @@ bool UFlowNode_DefineProperties::TryFindPropertyByPinName(
 	return Super::TryFindPropertyByPinName(PropertyOwnerObject, PinName, OutFoundProperty, OutFoundInstancedStruct);
 }
 
+bool UFlowNode_DefineProperties::TryFindDataPinValueSourceByPinName(
+	const UObject& PropertyOwnerObject,
+	const FName& PinName,
+	FFlowDataPinValueSource& OutSource) const
+{
+	// Same lookup order as TryFindPropertyByPinName, but pointing to the instanced struct instead of copying it
+
+	for (const FFlowNamedDataPinProperty& NamedProperty : NamedProperties)
+	{
+		if (NamedProperty.Name == PinName && NamedProperty.IsValid())
+		{
+			OutSource.DataPinValue = NamedProperty.DataPinValue.GetPtr();
+
+			return true;
+		}
+	}
+
+	return Super::TryFindDataPinValueSourceByPinName(PropertyOwnerObject, PinName, OutSource);
+}
+
 #if WITH_EDITOR
 void UFlowNode_DefineProperties::AutoGenerateDataPins(FFlowAutoDataPinsWorkingData& InOutWorkingData) const
 {
@@ -156,3 +212,79 @@ bool UFlowNode_DefineProperties::TryFormatTextWithNamedPropertiesAsParameters(co
 
 	return true;
 }
+
+bool UFlowNode_DefineProperties::TryFormatTextWithNamedPropertiesAsParameters(const FText& FormatText, FFlowNamedPropertiesFormatCache& Cache, FText& OutFormattedText) const
+{
+	if (NamedProperties.IsEmpty())
+	{
+		return false;
+	}
+
+	if (Cache.NamedPropertiesStamp != NamedPropertiesStamp || Cache.ArgumentStamps.Num() != NamedProperties.Num())
+	{
+		Cache.Reset();
+		Cache.NamedPropertiesStamp = NamedPropertiesStamp;
+		Cache.ArgumentStamps.SetNum(NamedProperties.Num());
+		Cache.CachedArguments.Init(false, NamedProperties.Num());
+	}
+
+	// parse the pattern only if the source text changed
+	if (!Cache.bFormatCompiled || !Cache.Format.GetSourceText().IdenticalTo(FormatText))
+	{
+		Cache.Format = FTextFormat(FormatText);
+		Cache.bFormatCompiled = true;
+		Cache.bFormatted = false;
+	}
+
+	bool bArgumentsChanged = false;
+	for (int32 Index = 0; Index < NamedProperties.Num(); ++Index)
+	{
+		const FFlowNamedDataPinProperty& NamedProperty = NamedProperties[Index];
+		if (!NamedProperty.Name.IsValid())
+		{
+			if (!Cache.CachedArguments[Index])
+			{
+				LogWarning(TEXT("Could not format text with a nameless named property"));
+				Cache.CachedArguments[Index] = true;
+			}
+			continue;
+		}
+
+		UFlowNode::TFlowPinValueSupplierStampArray SupplierStamps;
+		const bool bStamped = TryGetFlowDataPinValueStampsForPinName(NamedProperty.Name, SupplierStamps);
+		if (bStamped && Cache.CachedArguments[Index] && SupplierStamps == Cache.ArgumentStamps[Index])
+		{
+			continue;
+		}
+
+		bArgumentsChanged = true;
+
+		if (TryAddValueToFormatNamedArguments(NamedProperty, Cache.Arguments))
+		{
+			Cache.ArgumentStamps[Index] = MoveTemp(SupplierStamps);
+			Cache.CachedArguments[Index] = bStamped;
+		}
+		else
+		{
+			Cache.Arguments.Remove(NamedProperty.Name.ToString());
+			Cache.CachedArguments[Index] = false;
+
+			LogWarning(FString::Printf(TEXT("Could not format text for named property %s"), *NamedProperty.Name.ToString()));
+		}
+	}
+
+	// formatted numbers and dates depend on the current culture
+	const uint16 TextRevision = FTextLocalizationManager::Get().GetTextRevision();
+
+	if (bArgumentsChanged || !Cache.bFormatted || Cache.TextRevision != TextRevision)
+	{
+		Cache.FormattedText = FText::Format(Cache.Format, Cache.Arguments);
+		Cache.TextRevision = TextRevision;
+		Cache.bFormatted = true;
+		++Cache.FormattedTextStamp;
+	}
+
+	OutFormattedText = Cache.FormattedText;
+
+	return true;
+}
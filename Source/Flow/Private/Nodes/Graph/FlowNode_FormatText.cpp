@@ -7,6 +7,8 @@
 
 #define LOCTEXT_NAMESPACE "FlowNode_FormatText"
 
+const FName UFlowNode_FormatText::OUTPIN_TextOutput(TEXT("Formatted Text"));
+
 UFlowNode_FormatText::UFlowNode_FormatText(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -15,12 +17,19 @@ UFlowNode_FormatText::UFlowNode_FormatText(const FObjectInitializer& ObjectIniti
 	NodeDisplayStyle = FlowNodeStyle::Terminal;
 #endif
 
-	OutputPins.Add(FFlowPin(TEXT("Formatted Text"), FFlowPinType_Text::GetPinTypeNameStatic()));
+	OutputPins.Add(FFlowPin(OUTPIN_TextOutput, FFlowPinType_Text::GetPinTypeNameStatic()));
+}
+
+void UFlowNode_FormatText::ResetInstance(const UFlowNodeBase& Template)
+{
+	Super::ResetInstance(Template);
+
+	FormatTextCache.Reset();
 }
 
 FFlowDataPinResult UFlowNode_FormatText::TrySupplyDataPin_Implementation(FName PinName) const
 {
-	if (PinName == TEXT("Formatted Text"))
+	if (PinName == OUTPIN_TextOutput)
 	{
 		FText FormattedText;
 		const EFlowDataPinResolveResult FormatResult = TryResolveFormatText(PinName, FormattedText);
@@ -38,9 +47,55 @@ FFlowDataPinResult UFlowNode_FormatText::TrySupplyDataPin_Implementation(FName P
 	return Super::TrySupplyDataPin_Implementation(PinName);
 }
 
+EFlowDataPinResolveResult UFlowNode_FormatText::TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const
+{
+	// subclass might supply values differently
+	if (!SupportsTypedDataPinSupply())
+	{
+		return EFlowDataPinResolveResult::FailedUnimplemented;
+	}
+
+	if (PinName == OUTPIN_TextOutput)
+	{
+		FText FormattedText;
+		const EFlowDataPinResolveResult FormatResult = TryResolveFormatText(PinName, FormattedText);
+
+		if (!FlowPinType::IsSuccess(FormatResult))
+		{
+			return FormatResult;
+		}
+
+		const FFlowDataPinValue_Text FormattedValue(FormattedText);
+
+		FFlowDataPinValueSource Source;
+		Source.DataPinValue = &FormattedValue;
+		return Request.CopyValue(Source);
+	}
+
+	return Super::TrySupplyDataPinTyped(PinName, Request);
+}
+
+bool UFlowNode_FormatText::TryGetDataPinValueStamp(const FName& PinName, uint32& OutStamp) const
+{
+	if (PinName == OUTPIN_TextOutput)
+	{
+		// Refreshes the cache, so the stamp reflects current values of inputs
+		FText FormattedText;
+		if (FlowPinType::IsSuccess(TryResolveFormatText(PinName, FormattedText)) && FormatTextCache.AreAllArgumentsCached())
+		{
+			OutStamp = FormatTextCache.FormattedTextStamp;
+			return true;
+		}
+
+		return false;
+	}
+
+	return Super::TryGetDataPinValueStamp(PinName, OutStamp);
+}
+
 EFlowDataPinResolveResult UFlowNode_FormatText::TryResolveFormatText(const FName& PinName, FText& OutFormattedText) const
 {
-	if (TryFormatTextWithNamedPropertiesAsParameters(FormatText, OutFormattedText))
+	if (TryFormatTextWithNamedPropertiesAsParameters(FormatText, FormatTextCache, OutFormattedText))
 	{
 		return EFlowDataPinResolveResult::Success;
 	}
@@ -59,3 +59,40 @@ FFlowDataPinResult UFlowNode_Start::TrySupplyDataPin_Implementation(FName PinNam
 	return Super::TrySupplyDataPin_Implementation(PinName);
 }
 
+EFlowDataPinResolveResult UFlowNode_Start::TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const
+{
+	// subclass might supply values differently
+	if (!SupportsTypedDataPinSupply())
+	{
+		return EFlowDataPinResolveResult::FailedUnimplemented;
+	}
+
+	if (FlowDataPinValueSupplierInterface)
+	{
+		// Supplier implemented only in blueprint has no native interface
+		const IFlowDataPinValueSupplierInterface* ExternalSupplier = FlowDataPinValueSupplierInterface.GetInterface();
+		if (!ExternalSupplier)
+		{
+			return EFlowDataPinResolveResult::FailedUnimplemented;
+		}
+
+		const EFlowDataPinResolveResult SuppliedResult = ExternalSupplier->TrySupplyDataPinTyped(PinName, Request);
+		if (SuppliedResult != EFlowDataPinResolveResult::FailedUnknownPin)
+		{
+			return SuppliedResult;
+		}
+	}
+
+	return Super::TrySupplyDataPinTyped(PinName, Request);
+}
+
+bool UFlowNode_Start::TryGetDataPinValueStamp(const FName& PinName, uint32& OutStamp) const
+{
+	// Values supplied by the external supplier aren't literals
+	if (FlowDataPinValueSupplierInterface)
+	{
+		return false;
+	}
+
+	return Super::TryGetDataPinValueStamp(PinName, OutStamp);
+}
@@ -49,6 +49,15 @@ void UFlowNode_SubGraph::FlushContent()
 	{
 		GetFlowSubsystem()->RemoveSubFlow(this, EFlowFinishPolicy::Abort);
 	}
+
+	ReleaseAssetLoadHandle();
+}
+
+void UFlowNode_SubGraph::DeinitializeInstance()
+{
+	ReleaseAssetLoadHandle();
+
+	Super::DeinitializeInstance();
 }
 
 void UFlowNode_SubGraph::ExecuteInput(const FName& PinName)
@@ -68,6 +77,20 @@ void UFlowNode_SubGraph::ExecuteInput(const FName& PinName)
 		return;
 	}
 
+	if (IsAssetLoadPending() || (UFlowSettings::Get()->bAsyncLoadSubGraphs && Asset.Get() == nullptr))
+	{
+		// inputs will be executed after loading the asset
+		PendingInputs.Add(PinName);
+		RequestAssetLoad();
+
+		// load completed immediately or couldn't be requested, OnAssetLoaded reports the missing asset
+		if (!IsAssetLoadPending())
+		{
+			OnAssetLoaded();
+		}
+		return;
+	}
+
 	if (PinName == TEXT("Start"))
 	{
 		if (GetFlowSubsystem())
@@ -88,6 +111,9 @@ void UFlowNode_SubGraph::Cleanup()
 		GetFlowSubsystem()->RemoveSubFlow(this, EFlowFinishPolicy::Keep);
 	}
 
+	PendingInputs.Empty();
+	ReleaseAssetLoadHandle();
+
 	Super::Cleanup();
 }
 
@@ -103,6 +129,78 @@ void UFlowNode_SubGraph::OnLoad_Implementation()
 		GetFlowSubsystem()->LoadSubFlow(this, SavedAssetInstanceName);
 		SavedAssetInstanceName = FString();
 	}
+
+	// game was saved while the asset was loading
+	if (PendingInputs.Num() > 0)
+	{
+		RequestAssetLoad();
+		if (!IsAssetLoadPending())
+		{
+			OnAssetLoaded();
+		}
+	}
+}
+
+void UFlowNode_SubGraph::RequestAssetLoad()
+{
+	if (Asset.IsNull() || Asset.Get() || IsAssetLoadPending())
+	{
+		return;
+	}
+
+	// previous load completed without providing the asset, i.e. failed prefetch
+	ReleaseAssetLoadHandle();
+
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (FlowSubsystem == nullptr)
+	{
+		return;
+	}
+
+	AssetLoadHandle = FlowSubsystem->GetStreamableManager().RequestAsyncLoad(Asset.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &ThisClass::OnAssetLoaded));
+}
+
+void UFlowNode_SubGraph::OnAssetLoaded()
+{
+	// asset was only prefetched
+	if (PendingInputs.Num() == 0)
+	{
+		return;
+	}
+
+	if (Asset.Get() == nullptr)
+	{
+		LogError(FString::Printf(TEXT("Failed to load Flow Asset %s"), *Asset.ToString()));
+		PendingInputs.Empty();
+		Finish();
+		return;
+	}
+
+	const TArray<FName> InputsToExecute = MoveTemp(PendingInputs);
+	PendingInputs.Reset();
+	MarkSaveDirty();
+
+	for (const FName& PinName : InputsToExecute)
+	{
+		ExecuteInput(PinName);
+
+		if (ActivationState != EFlowNodeState::Active)
+		{
+			break;
+		}
+	}
+
+	// SubGraph instance keeps the template loaded now
+	ReleaseAssetLoadHandle();
+}
+
+void UFlowNode_SubGraph::ReleaseAssetLoadHandle()
+{
+	if (AssetLoadHandle.IsValid())
+	{
+		AssetLoadHandle->CancelHandle();
+		AssetLoadHandle.Reset();
+	}
 }
 
 #if WITH_EDITOR
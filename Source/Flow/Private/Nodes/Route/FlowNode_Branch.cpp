@@ -24,6 +24,7 @@ UFlowNode_Branch::UFlowNode_Branch(const FObjectInitializer& ObjectInitializer)
 	OutputPins.Add(FFlowPin(OUTPIN_False));
 
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
+	bSharedTemplate = true;
 }
 
 EFlowAddOnAcceptResult UFlowNode_Branch::AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const
@@ -36,8 +37,21 @@ EFlowAddOnAcceptResult UFlowNode_Branch::AcceptFlowNodeAddOnChild_Implementation
 	return Super::AcceptFlowNodeAddOnChild_Implementation(AddOnTemplate, AdditionalAddOnsToAssumeAreChildren);
 }
 
+void UFlowNode_Branch::OnChildPredicateChanged(UFlowNodeAddOn& Predicate)
+{
+	// result is needed only on input, so there's no need to re-evaluate now
+	PredicateCache.Invalidate(Predicate);
+}
+
+void UFlowNode_Branch::DeinitializeInstance()
+{
+	PredicateCache.Reset();
+
+	Super::DeinitializeInstance();
+}
+
 void UFlowNode_Branch::ExecuteInput(const FName& PinName)
 {
-	const bool bResult = UFlowNodeAddOn_PredicateAND::EvaluatePredicateAND(AddOns);
+	const bool bResult = UFlowNodeAddOn_PredicateAND::EvaluatePredicateAND(AddOns, PredicateCache);
 	TriggerOutput(bResult ? OUTPIN_True : OUTPIN_False, true);
 }
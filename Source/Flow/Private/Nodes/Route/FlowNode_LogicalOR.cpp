@@ -18,6 +18,8 @@ UFlowNode_LogicalOR::UFlowNode_LogicalOR(const FObjectInitializer& ObjectInitial
 	SetNumberedInputPins(0, 1);
 	InputPins.Add(FFlowPin(TEXT("Enable"), TEXT("Enabling resets Execution Count")));
 	InputPins.Add(FFlowPin(TEXT("Disable"), TEXT("Disabling resets Execution Count")));
+
+	bSharedTemplate = true;
 }
 
 void UFlowNode_LogicalOR::ExecuteInput(const FName& PinName)
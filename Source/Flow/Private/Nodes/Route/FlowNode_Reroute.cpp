@@ -12,6 +12,7 @@ UFlowNode_Reroute::UFlowNode_Reroute(const FObjectInitializer& ObjectInitializer
 #endif
 
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
+	bSharedTemplate = true;
 }
 
 void UFlowNode_Reroute::ExecuteInput(const FName& PinName)
@@ -151,6 +151,12 @@ void UFlowNode_Timer::Cleanup()
 	Super::Cleanup();
 }
 
+bool UFlowNode_Timer::IsSaveDirty() const
+{
+	// remaining time is read from the timer manager in OnSave
+	return Super::IsSaveDirty() || CompletionTimerHandle.IsValid() || StepTimerHandle.IsValid();
+}
+
 void UFlowNode_Timer::OnSave_Implementation()
 {
 	if (GetWorld())
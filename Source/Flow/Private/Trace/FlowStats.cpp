@@ -0,0 +1,206 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Trace/FlowStats.h"
+
+DEFINE_STAT(STAT_FlowNode_ExecuteInput);
+DEFINE_STAT(STAT_FlowNode_Activate);
+DEFINE_STAT(STAT_FlowNode_Cleanup);
+DEFINE_STAT(STAT_FlowNode_ResolveDataPin);
+DEFINE_STAT(STAT_FlowNode_Save);
+DEFINE_STAT(STAT_FlowNode_Load);
+
+#if FLOW_STATS_ENABLED
+
+#include "FlowAsset.h"
+#include "Nodes/FlowNodeBase.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/ObjectKey.h"
+
+bool FFlowNodeStats::bCollecting = false;
+FFlowNodeStatsScope* FFlowNodeStatsScope::Current = nullptr;
+
+static FAutoConsoleVariableRef CVarFlowStatsCollect(
+	TEXT("flow.stats.Collect"),
+	FFlowNodeStats::bCollecting,
+	TEXT("Collect time spent in Flow Node calls, aggregated by node class and template asset. Print results with flow.stats"));
+
+namespace FlowStats
+{
+	TMap<FObjectKey, FFlowNodeStats::FEntry> ClassEntries;
+	TMap<FObjectKey, FFlowNodeStats::FEntry> AssetEntries;
+
+	void RecordEntry(FFlowNodeStats::FEntry& Entry, const EFlowNodeStatsCategory Category, const uint64 Cycles)
+	{
+		const uint8 Index = static_cast<uint8>(Category);
+		Entry.Calls[Index]++;
+		Entry.TotalCycles[Index] += Cycles;
+		Entry.MaxCycles[Index] = FMath::Max(Entry.MaxCycles[Index], Cycles);
+	}
+
+	void DumpEntries(const TMap<FObjectKey, FFlowNodeStats::FEntry>& Entries, const TCHAR* Label, const int32 TopCount, FOutputDevice& Ar)
+	{
+		TArray<const FFlowNodeStats::FEntry*> SortedEntries;
+		SortedEntries.Reserve(Entries.Num());
+		for (const TPair<FObjectKey, FFlowNodeStats::FEntry>& Pair : Entries)
+		{
+			SortedEntries.Add(&Pair.Value);
+		}
+
+		const auto PrintEntries = [&SortedEntries, TopCount, &Ar]()
+		{
+			for (int32 Index = 0; Index < FMath::Min(TopCount, SortedEntries.Num()); Index++)
+			{
+				const FFlowNodeStats::FEntry& Entry = *SortedEntries[Index];
+
+				FString Categories;
+				for (uint8 CategoryIndex = 0; CategoryIndex < static_cast<uint8>(EFlowNodeStatsCategory::Max); CategoryIndex++)
+				{
+					if (Entry.Calls[CategoryIndex] > 0)
+					{
+						Categories += FString::Printf(TEXT(" %s %.3f/%llu"),
+							FFlowNodeStats::GetCategoryName(static_cast<EFlowNodeStatsCategory>(CategoryIndex)),
+							FPlatformTime::ToMilliseconds64(Entry.TotalCycles[CategoryIndex]), Entry.Calls[CategoryIndex]);
+					}
+				}
+
+				Ar.Logf(TEXT("  %10.3f ms %10.3f ms max %8llu calls  %s  [%s ]"),
+					FPlatformTime::ToMilliseconds64(Entry.GetTotalCycles()), FPlatformTime::ToMilliseconds64(Entry.GetMaxCycles()),
+					Entry.GetCalls(), *Entry.Name, *Categories);
+			}
+		};
+
+		Ar.Logf(TEXT("Top %s by cumulative time:"), Label);
+		SortedEntries.Sort([](const FFlowNodeStats::FEntry& A, const FFlowNodeStats::FEntry& B)
+		{
+			return A.GetTotalCycles() > B.GetTotalCycles();
+		});
+		PrintEntries();
+
+		Ar.Logf(TEXT("Top %s by longest call:"), Label);
+		SortedEntries.Sort([](const FFlowNodeStats::FEntry& A, const FFlowNodeStats::FEntry& B)
+		{
+			return A.GetMaxCycles() > B.GetMaxCycles();
+		});
+		PrintEntries();
+	}
+}
+
+uint64 FFlowNodeStats::FEntry::GetCalls() const
+{
+	uint64 Result = 0;
+	for (const uint64 Value : Calls)
+	{
+		Result += Value;
+	}
+	return Result;
+}
+
+uint64 FFlowNodeStats::FEntry::GetTotalCycles() const
+{
+	uint64 Result = 0;
+	for (const uint64 Value : TotalCycles)
+	{
+		Result += Value;
+	}
+	return Result;
+}
+
+uint64 FFlowNodeStats::FEntry::GetMaxCycles() const
+{
+	uint64 Result = 0;
+	for (const uint64 Value : MaxCycles)
+	{
+		Result = FMath::Max(Result, Value);
+	}
+	return Result;
+}
+
+void FFlowNodeStats::Record(const UFlowNodeBase& Node, const EFlowNodeStatsCategory Category, const uint64 Cycles)
+{
+	const UClass* NodeClass = Node.GetClass();
+	FEntry& ClassEntry = FlowStats::ClassEntries.FindOrAdd(NodeClass);
+	if (ClassEntry.Name.IsEmpty())
+	{
+		ClassEntry.Name = NodeClass->GetName();
+	}
+	FlowStats::RecordEntry(ClassEntry, Category, Cycles);
+
+	if (const UFlowAsset* FlowAsset = Node.GetFlowAsset())
+	{
+		const UFlowAsset* TemplateAsset = FlowAsset->GetTemplateAsset() ? FlowAsset->GetTemplateAsset() : FlowAsset;
+		FEntry& AssetEntry = FlowStats::AssetEntries.FindOrAdd(TemplateAsset);
+		if (AssetEntry.Name.IsEmpty())
+		{
+			AssetEntry.Name = TemplateAsset->GetPathName();
+		}
+		FlowStats::RecordEntry(AssetEntry, Category, Cycles);
+	}
+}
+
+void FFlowNodeStats::Reset()
+{
+	FlowStats::ClassEntries.Empty();
+	FlowStats::AssetEntries.Empty();
+}
+
+void FFlowNodeStats::Dump(const int32 TopCount, FOutputDevice& Ar)
+{
+	if (FlowStats::ClassEntries.Num() == 0)
+	{
+		Ar.Logf(TEXT("No Flow Node stats recorded%s"), bCollecting ? TEXT("") : TEXT(", enable collection with flow.stats.Collect 1"));
+		return;
+	}
+
+	FlowStats::DumpEntries(FlowStats::ClassEntries, TEXT("node classes"), TopCount, Ar);
+	FlowStats::DumpEntries(FlowStats::AssetEntries, TEXT("template assets"), TopCount, Ar);
+}
+
+const TCHAR* FFlowNodeStats::GetCategoryName(const EFlowNodeStatsCategory Category)
+{
+	switch (Category)
+	{
+		case EFlowNodeStatsCategory::ExecuteInput:
+			return TEXT("ExecuteInput");
+		case EFlowNodeStatsCategory::Activate:
+			return TEXT("Activate");
+		case EFlowNodeStatsCategory::Cleanup:
+			return TEXT("Cleanup");
+		case EFlowNodeStatsCategory::ResolveDataPin:
+			return TEXT("ResolveDataPin");
+		case EFlowNodeStatsCategory::Save:
+			return TEXT("Save");
+		case EFlowNodeStatsCategory::Load:
+			return TEXT("Load");
+		default:
+			return TEXT("Unknown");
+	}
+}
+
+void FFlowNodeStatsScope::Begin(const UFlowNodeBase& InNode, const EFlowNodeStatsCategory InCategory)
+{
+	Node = &InNode;
+	Category = InCategory;
+	Parent = Current;
+	Current = this;
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+void FFlowNodeStatsScope::End()
+{
+	const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+
+	// scopes are strictly nested on the game thread
+	check(Current == this);
+	Current = Parent;
+	if (Parent)
+	{
+		Parent->ChildCycles += ElapsedCycles;
+	}
+
+	FFlowNodeStats::Record(*Node, Category, ElapsedCycles - FMath::Min(ChildCycles, ElapsedCycles));
+}
+
+#endif
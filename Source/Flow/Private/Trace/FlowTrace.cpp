@@ -0,0 +1,199 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Trace/FlowTrace.h"
+
+#if FLOW_TRACE_ENABLED
+
+#include "FlowAsset.h"
+#include "Nodes/FlowNode.h"
+
+#include "HAL/PlatformTime.h"
+#include "UObject/ObjectKey.h"
+
+UE_TRACE_CHANNEL_DEFINE(FlowChannel)
+
+UE_TRACE_EVENT_BEGIN(Flow, TemplateSpec, NoSync|Important)
+	UE_TRACE_EVENT_FIELD(uint32, TemplateId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Path)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, NodeSpec, NoSync|Important)
+	UE_TRACE_EVENT_FIELD(uint32, TemplateId)
+	UE_TRACE_EVENT_FIELD(int32, NodeIndex)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, InstanceCreated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+	UE_TRACE_EVENT_FIELD(uint32, TemplateId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, InstanceStarted)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, InstanceFinished)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, InstanceRemoved)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, OutputTriggered)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+	UE_TRACE_EVENT_FIELD(int32, NodeIndex)
+	UE_TRACE_EVENT_FIELD(uint16, PinIndex)
+	UE_TRACE_EVENT_FIELD(uint8, ActivationType)
+UE_TRACE_EVENT_END()
+
+// Sent when handling of the input ends, so it carries the duration
+UE_TRACE_EVENT_BEGIN(Flow, InputExecuted)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+	UE_TRACE_EVENT_FIELD(int32, NodeIndex)
+	UE_TRACE_EVENT_FIELD(uint16, PinIndex)
+	UE_TRACE_EVENT_FIELD(uint16, Depth)
+	UE_TRACE_EVENT_FIELD(uint8, ActivationType)
+UE_TRACE_EVENT_END()
+
+namespace FlowTrace
+{
+	// Templates with names already sent, game thread only
+	static TSet<FObjectKey> TracedTemplates;
+}
+
+uint16 FFlowTraceInputScope::Depth = 0;
+
+void FFlowTrace::OutputTemplateSpec(const UFlowAsset& Template)
+{
+	bool bAlreadyTraced = false;
+	FlowTrace::TracedTemplates.Add(FObjectKey(&Template), &bAlreadyTraced);
+	if (bAlreadyTraced)
+	{
+		return;
+	}
+
+	const FString TemplatePath = Template.GetPathName();
+	UE_TRACE_LOG(Flow, TemplateSpec, FlowChannel)
+		<< TemplateSpec.TemplateId(Template.GetUniqueID())
+		<< TemplateSpec.Path(*TemplatePath, TemplatePath.Len());
+}
+
+void FFlowTrace::OutputInstanceCreated(const UFlowAsset& Instance)
+{
+	const UFlowAsset* Template = Instance.GetTemplateAsset();
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(FlowChannel) || Template == nullptr)
+	{
+		return;
+	}
+
+	if (!FlowTrace::TracedTemplates.Contains(FObjectKey(Template)))
+	{
+		OutputTemplateSpec(*Template);
+
+		// instance keeps the Execution Table it has been initialized with, node indices are valid for this table
+		if (Instance.ExecutionTable.IsValid())
+		{
+			const TArray<FGuid>& NodeGuids = Instance.ExecutionTable->GetNodeGuids();
+			for (int32 NodeIndex = 0; NodeIndex < NodeGuids.Num(); NodeIndex++)
+			{
+				if (const UFlowNode* Node = Template->GetNode(NodeGuids[NodeIndex]))
+				{
+					const FString NodeName = Node->GetName();
+					UE_TRACE_LOG(Flow, NodeSpec, FlowChannel)
+						<< NodeSpec.TemplateId(Template->GetUniqueID())
+						<< NodeSpec.NodeIndex(NodeIndex)
+						<< NodeSpec.Name(*NodeName, NodeName.Len());
+				}
+			}
+		}
+	}
+
+	UE_TRACE_LOG(Flow, InstanceCreated, FlowChannel)
+		<< InstanceCreated.Cycle(FPlatformTime::Cycles64())
+		<< InstanceCreated.InstanceId(Instance.GetUniqueID())
+		<< InstanceCreated.TemplateId(Template->GetUniqueID());
+}
+
+void FFlowTrace::OutputInstanceStarted(const UFlowAsset& Instance)
+{
+	UE_TRACE_LOG(Flow, InstanceStarted, FlowChannel)
+		<< InstanceStarted.Cycle(FPlatformTime::Cycles64())
+		<< InstanceStarted.InstanceId(Instance.GetUniqueID());
+}
+
+void FFlowTrace::OutputInstanceFinished(const UFlowAsset& Instance)
+{
+	UE_TRACE_LOG(Flow, InstanceFinished, FlowChannel)
+		<< InstanceFinished.Cycle(FPlatformTime::Cycles64())
+		<< InstanceFinished.InstanceId(Instance.GetUniqueID());
+}
+
+void FFlowTrace::OutputInstanceRemoved(const UFlowAsset& Instance)
+{
+	UE_TRACE_LOG(Flow, InstanceRemoved, FlowChannel)
+		<< InstanceRemoved.Cycle(FPlatformTime::Cycles64())
+		<< InstanceRemoved.InstanceId(Instance.GetUniqueID());
+}
+
+void FFlowTrace::OutputPinTriggered(const UFlowNode& Node, const int32 PinIndex, const EFlowPinActivationType ActivationType)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(FlowChannel))
+	{
+		return;
+	}
+
+	const UFlowAsset* FlowAsset = Node.GetFlowAsset();
+	UE_TRACE_LOG(Flow, OutputTriggered, FlowChannel)
+		<< OutputTriggered.Cycle(FPlatformTime::Cycles64())
+		<< OutputTriggered.InstanceId(FlowAsset ? FlowAsset->GetUniqueID() : 0)
+		<< OutputTriggered.NodeIndex(Node.ExecutionIndex)
+		<< OutputTriggered.PinIndex(static_cast<uint16>(PinIndex))
+		<< OutputTriggered.ActivationType(static_cast<uint8>(ActivationType));
+}
+
+FFlowTraceInputScope::FFlowTraceInputScope(const UFlowNode& InNode, const int32 InPinIndex, const EFlowPinActivationType InActivationType)
+	: PinIndex(InPinIndex)
+	, ActivationType(InActivationType)
+{
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(FlowChannel))
+	{
+		bEnabled = true;
+
+		// read now, handling the input might deinitialize the instance
+		const UFlowAsset* FlowAsset = InNode.GetFlowAsset();
+		InstanceId = FlowAsset ? FlowAsset->GetUniqueID() : 0;
+		NodeIndex = InNode.ExecutionIndex;
+
+		StartCycle = FPlatformTime::Cycles64();
+		Depth++;
+	}
+}
+
+FFlowTraceInputScope::~FFlowTraceInputScope()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	Depth--;
+
+	UE_TRACE_LOG(Flow, InputExecuted, FlowChannel)
+		<< InputExecuted.StartCycle(StartCycle)
+		<< InputExecuted.EndCycle(FPlatformTime::Cycles64())
+		<< InputExecuted.InstanceId(InstanceId)
+		<< InputExecuted.NodeIndex(NodeIndex)
+		<< InputExecuted.PinIndex(static_cast<uint16>(PinIndex))
+		<< InputExecuted.Depth(Depth)
+		<< InputExecuted.ActivationType(static_cast<uint8>(ActivationType));
+}
+
+#endif
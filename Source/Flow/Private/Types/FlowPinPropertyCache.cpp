@@ -0,0 +1,80 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowPinPropertyCache.h"
+#include "Types/FlowDataPinValue.h"
+
+#include "UObject/Class.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+
+TMap<FObjectKey, TMap<FName, FFlowCachedPinProperty>> FFlowPinPropertyCache::ClassProperties;
+FDelegateHandle FFlowPinPropertyCache::ReloadCompleteHandle;
+#if WITH_EDITOR
+FDelegateHandle FFlowPinPropertyCache::ObjectsReinstancedHandle;
+#endif
+
+FFlowCachedPinProperty FFlowPinPropertyCache::FindProperty(const UClass& Class, const FName& PinName)
+{
+	check(IsInGameThread());
+
+	TMap<FName, FFlowCachedPinProperty>& PinProperties = ClassProperties.FindOrAdd(FObjectKey(&Class));
+	if (const FFlowCachedPinProperty* CachedProperty = PinProperties.Find(PinName))
+	{
+		return *CachedProperty;
+	}
+
+	FFlowCachedPinProperty NewProperty;
+	NewProperty.Property = Class.FindPropertyByName(PinName);
+
+	if (NewProperty.Property)
+	{
+		NewProperty.Offset = NewProperty.Property->GetOffset_ForInternal();
+
+		const FStructProperty* StructProperty = CastField<FStructProperty>(NewProperty.Property);
+		if (StructProperty && StructProperty->Struct->IsChildOf(FFlowDataPinValue::StaticStruct()))
+		{
+			NewProperty.DataPinValueStruct = StructProperty->Struct;
+
+			// pin type is defined by virtual function, so we need an instance of the struct to read it
+			const FStructOnScope DefaultValue(StructProperty->Struct);
+			NewProperty.PinTypeName = reinterpret_cast<const FFlowDataPinValue*>(DefaultValue.GetStructMemory())->GetPinTypeName();
+		}
+	}
+
+	PinProperties.Add(PinName, NewProperty);
+	return NewProperty;
+}
+
+void FFlowPinPropertyCache::Flush()
+{
+	ClassProperties.Empty();
+}
+
+void FFlowPinPropertyCache::RegisterDelegates()
+{
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+	{
+		Flush();
+	});
+
+#if WITH_EDITOR
+	ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const TMap<UObject*, UObject*>&)
+	{
+		Flush();
+	});
+#endif
+}
+
+void FFlowPinPropertyCache::UnregisterDelegates()
+{
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	ReloadCompleteHandle.Reset();
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+	ObjectsReinstancedHandle.Reset();
+#endif
+
+	Flush();
+}
@@ -79,7 +79,7 @@ bool FFlowPinType_Enum::PopulateResult(const UObject& PropertyOwnerObject, const
 
 	if (ValueStruct.IsValid() && ValueStruct.Get<FFlowDataPinValue>().GetPinTypeName() == TFlowPinType::GetPinTypeNameStatic())
 	{
-		OutResult.ResultValue = ValueStruct;
+		OutResult.ResultValue = MoveTemp(ValueStruct);
 		OutResult.Result = EFlowDataPinResolveResult::Success;
 		return true;
 	}
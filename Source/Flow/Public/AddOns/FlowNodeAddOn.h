@@ -72,6 +72,10 @@ public:
 
 	// Will crawl the hierarchy until it finds a flow node (addons can be attached to other add-ons). 
 	FLOW_API UFlowNode* FindOwningFlowNode() const;
+
+	// Call it from observable predicate whenever its result might have changed, see IFlowPredicateInterface::IsPredicateObservable
+	UFUNCTION(BlueprintCallable, Category = "FlowNodeAddon")
+	FLOW_API void NotifyPredicateChanged();
 	// --
 
 	// Returns a random seed suitable for this flow node addon
@@ -22,9 +22,18 @@ public:
 
 	// UFlowNodeBase
 	virtual EFlowAddOnAcceptResult AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const override;
+	virtual void OnChildPredicateChanged(UFlowNodeAddOn& Predicate) override;
+	// --
+
+	// IFlowCoreExecutableInterface
+	virtual void DeinitializeInstance() override;
 	// --
 
 	// IFlowPredicateInterface
 	virtual bool EvaluatePredicate_Implementation() const override;
+	virtual bool IsPredicateObservable_Implementation() const override;
 	// --
+
+protected:
+	mutable FFlowPredicateResultCache PredicateCache;
 };
@@ -22,11 +22,23 @@ public:
 
 	// UFlowNodeBase
 	virtual EFlowAddOnAcceptResult AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const override;
+	virtual void OnChildPredicateChanged(UFlowNodeAddOn& Predicate) override;
+	// --
+
+	// IFlowCoreExecutableInterface
+	virtual void DeinitializeInstance() override;
 	// --
 
 	// IFlowPredicateInterface
 	virtual bool EvaluatePredicate_Implementation() const override;
+	virtual bool IsPredicateObservable_Implementation() const override;
 	// --
 
 	FLOW_API static bool EvaluatePredicateOR(const TArray<UFlowNodeAddOn*>& AddOns);
+
+	// Evaluates AddOns, reusing results of observable predicates kept in the cache
+	FLOW_API static bool EvaluatePredicateOR(const TArray<UFlowNodeAddOn*>& AddOns, FFlowPredicateResultCache& Cache);
+
+protected:
+	mutable FFlowPredicateResultCache PredicateCache;
 };
@@ -56,6 +56,7 @@ public:
 	// IFlowDataPinValueSupplierInterface
 	virtual bool CanSupplyDataPinValues_Implementation() const override;
 	virtual FFlowDataPinResult TrySupplyDataPin_Implementation(FName PinName) const override;
+	virtual EFlowDataPinResolveResult TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const override;
 	// --
 
 	// IFlowAssetProviderInterface
@@ -0,0 +1,114 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Misc/Guid.h"
+#include "UObject/ObjectPtr.h"
+
+class FProperty;
+class UFlowNode;
+
+// Input pin connected to the output pin, as dense indices into the Execution Table nodes and the target node InputPins
+struct FFlowExecutionEdge
+{
+	int32 NodeIndex = INDEX_NONE;
+	int32 PinIndex = INDEX_NONE;
+
+	bool IsConnected() const { return NodeIndex != INDEX_NONE && PinIndex != INDEX_NONE; }
+};
+
+// SaveGame property of a shared template node, which value is kept by every Flow Asset instance
+struct FFlowSharedNodeProperty
+{
+	const FProperty* Property = nullptr;
+
+	// Offset of the value in the instance memory block holding state of shared nodes
+	int32 StateOffset = 0;
+};
+
+/**
+ * Flow Asset graph compiled to flat arrays, shared by all instances of the template asset
+ * Allows dispatching signals by array indexing, instead of resolving node guids and pin names on every hop
+ */
+struct FLOW_API FFlowExecutionTable
+{
+private:
+	// Node index -> node guid
+	TArray<FGuid> NodeGuids;
+
+	// Node guid -> node index, used by guid-based API
+	TMap<FGuid, int32> NodeIndices;
+
+	// Node index -> index of its first output pin in OutputEdges, contains additional element marking the end of the last node
+	TArray<int32> FirstOutputEdges;
+
+	// Connections of all output pins, in order of node indices and their OutputPins
+	TArray<FFlowExecutionEdge> OutputEdges;
+
+	// Node index -> shared node index, INDEX_NONE if node is instantiated by every Flow Asset instance
+	TArray<int32> SharedNodeIndices;
+
+	// Shared node index -> index of its first property in SharedProperties, contains additional element marking the end of the last node
+	TArray<int32> FirstSharedProperties;
+
+	// State kept by instances for all shared nodes, in order of shared node indices
+	TArray<FFlowSharedNodeProperty> SharedProperties;
+
+	int32 SharedStateSize = 0;
+	int32 SharedStateAlignment = 1;
+
+public:
+	// Nodes are shared only if bShareTemplateNodes is set and the node allows it, see UFlowNodeBase::CanShareTemplate
+	void Compile(const TMap<FGuid, TObjectPtr<UFlowNode>>& Nodes, const bool bShareTemplateNodes = false);
+
+	int32 GetNodesNum() const { return NodeGuids.Num(); }
+	const TArray<FGuid>& GetNodeGuids() const { return NodeGuids; }
+
+	int32 FindNodeIndex(const FGuid& NodeGuid) const
+	{
+		const int32* NodeIndex = NodeIndices.Find(NodeGuid);
+		return NodeIndex ? *NodeIndex : INDEX_NONE;
+	}
+
+	const FFlowExecutionEdge* FindOutputEdge(const int32 NodeIndex, const int32 OutputPinIndex) const
+	{
+		if (!NodeGuids.IsValidIndex(NodeIndex) || OutputPinIndex < 0)
+		{
+			return nullptr;
+		}
+
+		const int32 EdgeIndex = FirstOutputEdges[NodeIndex] + OutputPinIndex;
+		return EdgeIndex < FirstOutputEdges[NodeIndex + 1] ? &OutputEdges[EdgeIndex] : nullptr;
+	}
+
+	// Connections of all output pins of the node, in order of its OutputPins
+	TConstArrayView<FFlowExecutionEdge> GetOutputEdges(const int32 NodeIndex) const
+	{
+		if (!NodeGuids.IsValidIndex(NodeIndex))
+		{
+			return {};
+		}
+
+		return MakeArrayView(OutputEdges).Slice(FirstOutputEdges[NodeIndex], FirstOutputEdges[NodeIndex + 1] - FirstOutputEdges[NodeIndex]);
+	}
+
+	int32 GetSharedNodesNum() const { return FirstSharedProperties.Num() - 1; }
+
+	int32 GetSharedNodeIndex(const int32 NodeIndex) const
+	{
+		return SharedNodeIndices.IsValidIndex(NodeIndex) ? SharedNodeIndices[NodeIndex] : INDEX_NONE;
+	}
+
+	TConstArrayView<FFlowSharedNodeProperty> GetSharedProperties(const int32 SharedNodeIndex) const
+	{
+		return MakeArrayView(SharedProperties).Slice(FirstSharedProperties[SharedNodeIndex], FirstSharedProperties[SharedNodeIndex + 1] - FirstSharedProperties[SharedNodeIndex]);
+	}
+
+	// All shared properties, for initializing and destroying the instance memory block
+	const TArray<FFlowSharedNodeProperty>& GetAllSharedProperties() const { return SharedProperties; }
+
+	int32 GetSharedStateSize() const { return SharedStateSize; }
+	int32 GetSharedStateAlignment() const { return SharedStateAlignment; }
+};
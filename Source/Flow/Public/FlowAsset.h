@@ -5,12 +5,15 @@
 #include "FlowSave.h"
 #include "FlowTypes.h"
 #include "Asset/FlowAssetParamsTypes.h"
+#include "Asset/FlowExecutionTable.h"
 #include "Nodes/FlowNode.h"
 
 #if WITH_EDITOR
 #include "FlowMessageLog.h"
 #endif
 
+#include "Engine/StreamableManager.h"
+#include "Engine/TimerHandle.h"
 #include "UObject/ObjectKey.h"
 #include "FlowAsset.generated.h"
 
@@ -24,9 +27,66 @@ class UEdGraphNode;
 class UFlowAsset;
 class UFlowAssetParams;
 
+// Pin activation waiting for execution, used by the Queued signal propagation
+struct FFlowPendingSignal
+{
+	int32 NodeIndex;
+	int32 PinIndex;
+	FConnectedPin FromPin;
+
+	FFlowPendingSignal(const int32 InNodeIndex, const int32 InPinIndex, const FConnectedPin& InFromPin)
+		: NodeIndex(InNodeIndex)
+		, PinIndex(InPinIndex)
+		, FromPin(InFromPin)
+	{
+	}
+};
+
+/**
+ * State of shared template nodes kept by a single Flow Asset instance, see UFlowNodeBase::bSharedTemplate
+ * SaveGame property values of all shared nodes live in one memory block, laid out by the Execution Table
+ */
+struct FLOW_API FFlowSharedNodesState
+{
+	FFlowSharedNodesState(const TSharedRef<const FFlowExecutionTable>& InExecutionTable, TConstArrayView<TObjectPtr<UFlowNode>> IndexedNodes);
+	~FFlowSharedNodesState();
+
+	UE_NONCOPYABLE(FFlowSharedNodesState);
+
+	// Exchanges state of the template node with the state kept here
+	void Swap(UFlowNode& Node);
+
+	// Reads the save dirty flag of the instance without swapping its state into the template node
+	bool IsSaveDirty(const UFlowNode& Node) const;
+
+private:
+	TSharedRef<const FFlowExecutionTable> ExecutionTable;
+	uint8* Memory = nullptr;
+
+	// Shared node index -> UFlowNode runtime members
+	TArray<FFlowNodeInstanceState> NodeStates;
+};
+
+/**
+ * Swaps state kept by the Flow Asset instance into the shared template node for the duration of the scope
+ * Does nothing for nodes instantiated by the Flow Asset instance. Nested scope of another instance swaps the previous state out first
+ */
+struct FLOW_API FFlowSharedNodeScope
+{
+	FFlowSharedNodeScope(UFlowAsset& Instance, UFlowNode& InNode);
+	~FFlowSharedNodeScope();
+
+	UE_NONCOPYABLE(FFlowSharedNodeScope);
+
+private:
+	UFlowNode* Node = nullptr;
+	UFlowAsset* PreviousInstance = nullptr;
+	TSharedPtr<FFlowSharedNodesState> PreviousState;
+};
+
 #if !UE_BUILD_SHIPPING
 DECLARE_DELEGATE(FFlowGraphEvent);
-DECLARE_DELEGATE_TwoParams(FFlowSignalEvent, const FGuid& /*NodeGuid*/, const FName& /*PinName*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FFlowPinTriggeredEvent, const UFlowAsset* /*Instance*/, const FGuid& /*NodeGuid*/, const FName& /*PinName*/);
 #endif
 
 /**
@@ -42,6 +102,8 @@ public:
 	friend class UFlowNode_CustomOutput;
 	friend class UFlowNode_SubGraph;
 	friend class UFlowSubsystem;
+	friend struct FFlowSharedNodeScope;
+	friend struct FFlowTrace;
 
 	friend class FFlowAssetDetails;
 	friend class FFlowNode_SubGraphDetails;
@@ -55,6 +117,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flow Asset")
 	bool bWorldBound;
 
+	// Queued propagation executes pin activations in a loop on the asset instance, instead of calling connected nodes recursively
+	// Use it for graphs with long chains of instant nodes, as every node in such chain would grow the call stack
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flow Asset")
+	EFlowSignalPropagation SignalPropagation;
+
+	// Max number of input activations executed by a single asset instance per frame, if signals are Queued. Zero means no limit
+	// Activations exceeding this budget are executed in the next frame
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flow Asset", meta = (ClampMin = 0, EditCondition = "SignalPropagation == EFlowSignalPropagation::Queued"))
+	int32 SignalsPerFrameBudget;
+
+	// Instances with higher priority execute their deferred signals first, if Flow Subsystem runs out of the Signal Frame Budget
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flow Asset", meta = (EditCondition = "SignalPropagation == EFlowSignalPropagation::Queued"))
+	int32 SignalPriority;
+
+	// Number of finished instances kept for reuse by the next instances of this asset. Zero disables pooling
+	// Reused instance doesn't create node and AddOn objects again, useful for graphs started and finished very often, i.e. ambient NPC behaviors
+	// Finished nodes are reset to the template values, see UFlowNodeBase::ResetInstance. Pointers to a finished instance may later point to its reused self
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flow Asset", meta = (ClampMin = 0))
+	int32 InstancePoolSize;
+
 //////////////////////////////////////////////////////////////////////////
 // Graph (editor-only)
 
@@ -207,8 +289,10 @@ protected:
 			OutNodes.Emplace(NodeOfRequiredType);
 		}
 
-		for (UFlowNode* ConnectedNode : Node->GatherConnectedNodes())
+		// connected nodes are resolved by this asset, as shared template nodes would resolve nodes of the template asset
+		for (const TPair<FName, FConnectedPin>& Connection : Node->Connections)
 		{
+			UFlowNode* ConnectedNode = GetNode(Connection.Value.NodeGuid);
 			if (ConnectedNode && !IteratedNodes.Contains(ConnectedNode))
 			{
 				GetNodesInExecutionOrder_Recursive(ConnectedNode, IteratedNodes, OutNodes);
@@ -251,10 +335,16 @@ private:
 	TSharedPtr<class FFlowMessageLog> RuntimeLog;
 #endif
 
+	// Graph compiled to dense node and pin indices, shared by instances
+	TSharedPtr<const FFlowExecutionTable> CompiledExecutionTable;
+
 public:
 	void AddInstance(UFlowAsset* Instance);
 	int32 RemoveInstance(UFlowAsset* Instance);
 
+	// Compiles the template graph, if it hasn't been compiled yet
+	TSharedPtr<const FFlowExecutionTable> GetCompiledExecutionTable();
+
 	void ClearInstances();
 	int32 GetInstancesNum() const { return ActiveInstances.Num(); }
 
@@ -304,16 +394,74 @@ protected:
 	UPROPERTY()
 	TSet<TObjectPtr<UFlowNode>> PreloadedNodes;
 
-	// Nodes that have any work left, not marked as Finished yet
+	// Nodes that have any work left, not marked as Finished yet, in order of activation
 	UPROPERTY()
 	TArray<TObjectPtr<UFlowNode>> ActiveNodes;
 
 	// All nodes active in the past, done their work
+	// Every node is listed once, in order of the first activation
 	UPROPERTY()
 	TArray<TObjectPtr<UFlowNode>> RecordedNodes;
 
 	EFlowFinishPolicy FinishPolicy;
 
+private:
+	// Execution table of the template asset, kept by instance in case the template would be recompiled while this instance runs
+	TSharedPtr<const FFlowExecutionTable> ExecutionTable;
+
+	// Node instances by the Execution Table node index
+	TArray<TObjectPtr<UFlowNode>> IndexedNodes;
+
+	// Execution Table node index -> is node on the ActiveNodes list
+	TBitArray<> ActiveNodeFlags;
+
+	// Execution Table node index -> position on the ActiveNodes list, INDEX_NONE if node isn't active
+	TArray<int32> ActiveNodePositions;
+
+	// Execution Table node index -> is node on the RecordedNodes list
+	TBitArray<> RecordedNodeFlags;
+
+	// Set while instance waits in the pool, so the next initialization reuses node instances
+	bool bPooledInstance = false;
+
+	// State of nodes executing against the template, valid only if the Execution Table contains shared nodes
+	TSharedPtr<FFlowSharedNodesState> SharedNodesState;
+
+	// Starts loading SubGraph assets reachable within SubGraphPrefetchDepth connections from the node
+	void PrefetchSubGraphs(const UFlowNode& FromNode) const;
+
+	// Breadth-first walk over connections from the given nodes, every node is visited once at its shortest distance
+	// Starting nodes aren't visited. Walk stops after visiting MaxNodes nodes
+	void VisitNodesAhead(TConstArrayView<int32> FromNodeIndices, const int32 MaxDepth, const int32 MaxNodes, TFunctionRef<void(UFlowNode&)> Visitor) const;
+
+	struct FPrefetchedContent
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		int64 ReservedBytes = 0;
+	};
+
+	// Content requested by the prefetcher, kept loaded while any active node leads to it
+	TMap<FSoftObjectPath, FPrefetchedContent> PrefetchedContent;
+
+	bool bContentPrefetchScheduled = false;
+
+	// Prefetch is updated once per frame, after active nodes changed
+	void ScheduleContentPrefetch();
+	void UpdateContentPrefetch();
+	void OnPrefetchedContentLoaded(FSoftObjectPath Path);
+	void FlushPrefetchedContent();
+
+	bool IsNodeActive(const UFlowNode* Node) const
+	{
+		return ActiveNodeFlags.IsValidIndex(Node->ExecutionIndex) && ActiveNodeFlags[Node->ExecutionIndex];
+	}
+
+	void AddActiveNode(UFlowNode* Node);
+	void RemoveActiveNode(const UFlowNode* Node);
+	void ClearActiveNodes();
+
+	void RecordNode(UFlowNode* Node);
+
 public:
 	UE_DEPRECATED(5.4, "Use version that takes a UFlowAssetReference instead.")
 	virtual void InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlowAsset* InTemplateAsset) { InitializeInstance(InOwner, *InTemplateAsset); }
@@ -322,6 +470,13 @@ public:
 	virtual void DeinitializeInstance();
 	bool IsInstanceInitialized() const { return IsValid(TemplateAsset); }
 
+	// Can this deinitialized instance be reused by the next instance of the template?
+	virtual bool CanBePooled() const;
+
+	// Restores deinitialized instance to the state of a newly created instance of the template, keeping the node instances
+	// Properties declared by subclasses of UFlowAsset are copied from the template, i.e. Blueprint variables
+	virtual void ResetInstance(const UFlowAsset& Template);
+
 	UFlowAsset* GetTemplateAsset() const { return TemplateAsset; }
 
 	// Object that spawned Root Flow instance, i.e. World Settings or Player Controller
@@ -357,15 +512,74 @@ protected:
 	void TriggerCustomInput_FromSubGraph(UFlowNode_SubGraph* Node, const FName& EventName) const;
 	void TriggerCustomOutput(const FName& EventName);
 
+	// Guid and name based adapter to TriggerInputByIndex, signals propagated between nodes don't call it
 	// TODO: Extend FromPin through to Node level Trigger functions
+	UE_DEPRECATED(5.5, "Signals are propagated by TriggerInputByIndex, please override it to intercept inputs.")
 	virtual void TriggerInput(const FGuid& NodeGuid, const FName& PinName, const FConnectedPin& FromPin);
 
+	// Indices as stored in the Execution Table: node index and index of node's input pin
+	// Every input triggered by a connection goes through it, override it to intercept or redirect inputs
+	virtual void TriggerInputByIndex(const int32 NodeIndex, const int32 PinIndex, const FConnectedPin& FromPin);
+
+	// Node instance by the Execution Table node index, input pin name is GetInputPins()[PinIndex].PinName
+	UFlowNode* GetNodeByIndex(const int32 NodeIndex) const { return IndexedNodes.IsValidIndex(NodeIndex) ? IndexedNodes[NodeIndex] : nullptr; }
+
+	// Called by nodes triggering outputs, finds input connected to the output in the Execution Table
+	void PropagateOutput(const UFlowNode& FromNode, const int32 OutputPinIndex);
+
+	// Executes connected input instantly or queues it, depending on Signal Propagation
+	void PropagateSignal(const int32 NodeIndex, const int32 PinIndex, const FConnectedPin& FromPin);
+	void ExecutePendingSignals();
+
+	// Timer callback, continues signals left after reaching SignalsPerFrameBudget
+	void ExecuteScheduledSignals();
+
+public:
+	// Override it to prioritize deferred signals by the instance owner
+	virtual int32 GetSignalPriority() const { return SignalPriority; }
+
+	int32 GetPendingSignalsNum() const { return PendingSignals.Num() + ExternalSignals.Num() - ExternalSignalsHead; }
+
+private:
+	// Pin activations waiting for execution, if signals are Queued
+	// Used as a stack, so the chain started by an output is completed before executing the next output of the same node
+	TArray<FFlowPendingSignal> PendingSignals;
+
+	// Signals triggered by external events while other signals were waiting, executed in order once PendingSignals are drained
+	// Consumed from ExternalSignalsHead, so queuing a signal doesn't move signals already waiting
+	TArray<FFlowPendingSignal> ExternalSignals;
+	int32 ExternalSignalsHead = 0;
+
+	bool bExecutingPendingSignals = false;
+	FTimerHandle PendingSignalsTimerHandle;
+
+	uint64 SignalBudgetFrame = 0;
+	int32 SignalsExecutedThisFrame = 0;
+
+protected:
+
 	virtual void FinishNode(UFlowNode* Node);
 	void ResetNodes();
 
 #if !UE_BUILD_SHIPPING
-public:	
-	FFlowSignalEvent OnPinTriggered;
+public:
+	/* Called after triggering input or output pin
+	 * Broadcast on the instance executing the node, and on the template asset for pins of all its instances */
+	FFlowPinTriggeredEvent OnPinTriggered;
+
+	void BroadcastPinTriggered(const FGuid& NodeGuid, const FName& PinName) const
+	{
+		// listeners are rare, so check the invocation lists before preparing the broadcast
+		if (OnPinTriggered.IsBound())
+		{
+			OnPinTriggered.Broadcast(this, NodeGuid, PinName);
+		}
+
+		if (TemplateAsset && TemplateAsset->OnPinTriggered.IsBound())
+		{
+			TemplateAsset->OnPinTriggered.Broadcast(this, NodeGuid, PinName);
+		}
+	}
 #endif
 	
 public:
@@ -407,9 +621,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	FFlowAssetSaveData SaveInstance(TArray<FFlowAssetSaveData>& SavedFlowInstances);
 
+	// Adds records of this instance and its SubGraphs to the list, without copying them. Record of this instance is the last one
+	void CaptureInstance(TArray<FFlowAssetSaveData>& SavedFlowInstances);
+
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	void LoadInstance(const FFlowAssetSaveData& AssetRecord);
 
+	// Call after changing SaveGame properties of this instance, so incremental save would serialize it again
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	void MarkSaveDirty() { bSaveDirty = true; }
+
+	// Should the next incremental save rebuild the record of this instance, instead of reusing the record cached by the previous save?
+	// True also if any active node needs to be serialized again
+	virtual bool IsSaveDirty() const;
+
+private:
+	const TArray<TObjectPtr<UFlowNode>>& GetNodesInSaveOrder();
+
+	// Nodes reachable from the default Entry node in execution order, the graph doesn't change at runtime so it's walked once
+	TArray<TObjectPtr<UFlowNode>> NodesInSaveOrder;
+
+	// Record written by the previous incremental save
+	FFlowAssetSaveData CachedSaveRecord;
+
+	bool bSaveDirty = true;
+
 protected:
 	virtual void OnActivationStateLoaded(UFlowNode* Node);
 
@@ -249,12 +249,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	bool LoadInstance();
 
+	// Call after changing SaveGame properties, so incremental save would serialize this component again
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	void MarkSaveDirty() { bSaveDirty = true; }
+
+	// Should the next incremental save serialize this component, instead of reusing the record cached by the previous save?
+	virtual bool IsSaveDirty() const;
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "SaveGame")
 	void OnSave();
 	
 	UFUNCTION(BlueprintNativeEvent, Category = "SaveGame")
 	void OnLoad();
+
+private:
+	void SetSavedAssetInstanceName(const FString& NewName);
+
+	// ComponentData serialized by the previous incremental save
+	TArray<uint8> CachedSaveData;
+
+	bool bSaveDirty = true;
 	
 //////////////////////////////////////////////////////////////////////////
 // Helpers
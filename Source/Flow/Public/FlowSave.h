@@ -74,6 +74,81 @@ struct FLOW_API FFlowArchive : public FObjectAndNameAsStringProxyArchive
 	}
 };
 
+// Names and objects referenced by a compact SaveGame record, serialized once per record
+struct FLOW_API FFlowSaveRecordTables
+{
+	TArray<FName> Names;
+	TMap<FName, int32> NameIndices;
+
+	TArray<FString> ObjectPaths;
+	TMap<FString, int32> ObjectIndices;
+
+	// Objects resolved from ObjectPaths, while loading
+	TArray<UObject*> Objects;
+
+	void Serialize(FArchive& Ar);
+};
+
+/**
+ * Compact SaveGame archive, writing names and object references as indices into the record tables
+ * Unlike FFlowArchive, every name and object path is written only once per record
+ */
+struct FLOW_API FFlowCompactArchive : public FArchiveProxy
+{
+	FFlowCompactArchive(FArchive& InInnerArchive, FFlowSaveRecordTables& InTables);
+
+	using FArchiveProxy::operator<<;
+
+	virtual FArchive& operator<<(FName& Value) override;
+	virtual FArchive& operator<<(UObject*& Value) override;
+	virtual FArchive& operator<<(FWeakObjectPtr& Value) override;
+	virtual FArchive& operator<<(FSoftObjectPtr& Value) override;
+	virtual FArchive& operator<<(FSoftObjectPath& Value) override;
+	virtual FArchive& operator<<(FObjectPtr& Value) override;
+
+	virtual FString GetArchiveName() const override { return TEXT("FFlowCompactArchive"); }
+
+private:
+	FFlowSaveRecordTables& Tables;
+};
+
+/**
+ * Flow records of a single save, captured on the game thread by UFlowSubsystem
+ * FlowSave::EncodeSnapshot doesn't touch any UObject, so it can run on a worker thread
+ */
+struct FLOW_API FFlowSaveSnapshot
+{
+	// Records moved out of the target SaveGame. Records of the captured world and global records are replaced by the captured ones
+	TArray<FFlowAssetSaveData> PreviousFlowInstances;
+	TArray<FFlowComponentSaveData> PreviousFlowComponents;
+
+	// Unset if the subsystem had no world, then no previous records are replaced
+	TOptional<FString> WorldName;
+
+	// Captured records, not compressed yet. After encoding, these are complete lists to be moved into the SaveGame
+	TArray<FFlowAssetSaveData> FlowInstances;
+	TArray<FFlowComponentSaveData> FlowComponents;
+
+	// Flow Settings copied on capture, so the worker thread doesn't read them
+	bool bCompressRecords = false;
+	int32 CompressionThreshold = 0;
+};
+
+// Serializes Flow objects into SaveGame records, in the format selected in Flow Settings
+// Loading detects the record format, so records saved before enabling the compact format are still readable
+namespace FlowSave
+{
+	// Game thread only. Records aren't compressed here, that's left to EncodeRecord
+	FLOW_API void SaveObject(UObject& Object, TArray<uint8>& OutRecordData);
+	FLOW_API void LoadObject(UObject& Object, const TArray<uint8>& RecordData);
+
+	// Compresses the compact record in place, if it's larger than the threshold and compression pays off. Thread-safe
+	FLOW_API void EncodeRecord(TArray<uint8>& InOutRecordData, const int32 CompressionThreshold);
+
+	// Compresses captured records and merges them with previous records of the SaveGame. Thread-safe
+	FLOW_API void EncodeSnapshot(FFlowSaveSnapshot& Snapshot);
+}
+
 UCLASS(BlueprintType)
 class FLOW_API UFlowSaveGame : public USaveGame
 {
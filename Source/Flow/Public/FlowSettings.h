@@ -31,6 +31,26 @@ class FLOW_API UFlowSettings : public UDeveloperSettings
 	UPROPERTY(Config, EditAnywhere, Category = "SaveSystem")
 	bool bWarnAboutMissingIdentityTags;
 
+	// Save records in the compact format, writing every name and object path once per record instead of each time it's referenced
+	// Records saved in the previous format are still loaded, regardless of this setting
+	// Disabled by default, as compact records can't be loaded by builds without this format
+	UPROPERTY(Config, EditAnywhere, Category = "SaveSystem")
+	bool bCompactSaveData;
+
+	// Compress compact save records with Oodle, if they're larger than the threshold
+	// Records are compressed while Flow Subsystem writes them to the SaveGame, on a worker thread if saved by SaveGameAsync
+	UPROPERTY(Config, EditAnywhere, Category = "SaveSystem", meta = (EditCondition = "bCompactSaveData"))
+	bool bCompressSaveData;
+
+	UPROPERTY(Config, EditAnywhere, Category = "SaveSystem", meta = (EditCondition = "bCompactSaveData && bCompressSaveData", ClampMin = 0, Units = "Bytes"))
+	int32 SaveDataCompressionThreshold;
+
+	// Serialize only Flow Assets, Flow Nodes and Flow Components changed since the previous save, reuse records cached by that save for the rest
+	// Changes are detected on node activation, finish and pin triggers, identity tag edits and MarkSaveDirty calls
+	// Objects overriding OnSave in Blueprint are always serialized. Native classes collecting changing data in OnSave should override IsSaveDirty
+	UPROPERTY(Config, EditAnywhere, Category = "SaveSystem")
+	bool bIncrementalSaveData;
+
 	// If enabled, runtime logs will be added when a flow node signal mode is set to Disabled
 	UPROPERTY(Config, EditAnywhere, Category = "Flow")
 	bool bLogOnSignalDisabled;
@@ -39,6 +59,48 @@ class FLOW_API UFlowSettings : public UDeveloperSettings
 	UPROPERTY(Config, EditAnywhere, Category = "Flow")
 	bool bLogOnSignalPassthrough;
 
+	// Max time in microseconds spent per frame on executing Queued signals of all Flow Asset instances. Zero means no limit
+	// Signals exceeding this budget are executed in the next frame, starting from asset instances with the highest Signal Priority
+	UPROPERTY(Config, EditAnywhere, Category = "Flow", meta = (ClampMin = 0, Units = "Microseconds"))
+	int32 SignalFrameBudget;
+
+	// Load SubGraph assets asynchronously, instead of blocking the game thread on activating SubGraph with unloaded asset
+	// Inputs triggered while the asset is loading are buffered and executed once it's loaded
+	UPROPERTY(Config, EditAnywhere, Category = "Flow")
+	bool bAsyncLoadSubGraphs;
+
+	// Activating a node starts loading SubGraph assets reachable within this number of connections. Zero disables prefetching
+	UPROPERTY(Config, EditAnywhere, Category = "Flow", meta = (EditCondition = "bAsyncLoadSubGraphs", ClampMin = 0))
+	int32 SubGraphPrefetchDepth;
+
+	// Nodes supporting it, i.e. Reroute or Sequence, execute against the template node instead of creating node object per Flow Asset instance
+	// SaveGame properties of such nodes are kept by every instance and swapped into the template while it executes. See UFlowNodeBase::bSharedTemplate
+	// Debugger doesn't show pin activations of shared nodes
+	UPROPERTY(Config, EditAnywhere, Category = "Flow")
+	bool bShareTemplateNodes;
+
+	// How many recent activations of every pin are kept for the debugger, older records are overwritten
+	// Pin activations aren't recorded in Shipping builds
+	UPROPERTY(Config, EditAnywhere, Category = "Flow", meta = (ClampMin = 1))
+	int32 PinRecordsLimit;
+
+	// Asynchronously load content referenced by nodes ahead of active nodes, and release it once no active node leads to them
+	// Content is gathered by UFlowNode::GatherPrefetchContent, by default from all soft references of the node and its AddOns
+	UPROPERTY(Config, EditAnywhere, Category = "Content Prefetch")
+	bool bPrefetchContent;
+
+	// Number of connections walked from every active node
+	UPROPERTY(Config, EditAnywhere, Category = "Content Prefetch", meta = (EditCondition = "bPrefetchContent", ClampMin = 1))
+	int32 ContentPrefetchDepth;
+
+	// Max number of nodes visited by a single walk of a Flow Asset instance. Nodes closer to the active nodes are visited first
+	UPROPERTY(Config, EditAnywhere, Category = "Content Prefetch", meta = (EditCondition = "bPrefetchContent", ClampMin = 1))
+	int32 ContentPrefetchNodeBudget;
+
+	// Max size of content kept loaded by prefetching in all Flow Asset instances, measured as resident size of loaded assets. Zero means no limit
+	UPROPERTY(Config, EditAnywhere, Category = "Content Prefetch", meta = (EditCondition = "bPrefetchContent", ClampMin = 0, Units = "Megabytes"))
+	int32 ContentPrefetchMemoryBudget;
+
 	// Adjust the Titles for FlowNodes to be more expressive than default
 	// by incorporating data that would otherwise go in the Description
 	UPROPERTY(EditAnywhere, config, Category = "Nodes")
@@ -2,23 +2,90 @@
 
 #pragma once
 
+#include "Async/Future.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "FlowComponent.h"
+#include "Types/FlowArray.h"
 #include "FlowSubsystem.generated.h"
 
 class UFlowAsset;
 class UFlowNode_SubGraph;
 class IFlowDataPinValueSupplierInterface;
+struct FFlowSaveSnapshot;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSimpleFlowEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSimpleFlowComponentEvent, UFlowComponent*, Component);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FTaggedFlowComponentEvent, UFlowComponent*, Component, const FGameplayTagContainer&, Tags);
 
+DECLARE_DYNAMIC_DELEGATE_OneParam(FFlowSaveGameEvent, UFlowSaveGame*, SaveGame);
+
 DECLARE_DELEGATE_OneParam(FNativeFlowAssetEvent, class UFlowAsset*);
 
+DECLARE_DELEGATE_OneParam(FNativeFlowComponentEvent, UFlowComponent*);
+DECLARE_DELEGATE_TwoParams(FNativeTaggedFlowComponentEvent, UFlowComponent*, const FGameplayTagContainer&);
+
+/**
+ * Native observer of Flow Components registered in the Flow Subsystem
+ * Unlike the global OnComponent* events, observer is called only for components which Identity Tags can match observer's Identity Tags
+ * Observer still needs to check if component actually matches, i.e. HasAll requires checking all tags
+ */
+struct FLOW_API FFlowComponentObserver
+{
+	FGameplayTagContainer IdentityTags;
+	EFlowTagContainerMatchType MatchType;
+
+	FNativeFlowComponentEvent OnComponentRegistered;
+	FNativeTaggedFlowComponentEvent OnComponentTagAdded;
+	FNativeTaggedFlowComponentEvent OnComponentTagRemoved;
+	FNativeFlowComponentEvent OnComponentUnregistered;
+
+	FFlowComponentObserver()
+		: MatchType(EFlowTagContainerMatchType::HasAnyExact)
+	{
+	}
+
+	FFlowComponentObserver(const FGameplayTagContainer& InIdentityTags, const EFlowTagContainerMatchType InMatchType)
+		: IdentityTags(InIdentityTags)
+		, MatchType(InMatchType)
+	{
+	}
+
+	bool RequiresExactMatch() const
+	{
+		return MatchType == EFlowTagContainerMatchType::HasAnyExact || MatchType == EFlowTagContainerMatchType::HasAllExact;
+	}
+};
+
+/* Finished instances of a template asset, waiting for reuse */
+USTRUCT()
+struct FFlowInstancePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UFlowAsset>> Instances;
+};
+
+/* SaveGame with records being encoded on a worker thread, see UFlowSubsystem::SaveGameAsync */
+USTRUCT()
+struct FFlowPendingSaveGame
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UFlowSaveGame> SaveGame = nullptr;
+
+	UPROPERTY()
+	FFlowSaveGameEvent OnCompleted;
+
+	TSharedPtr<FFlowSaveSnapshot> Snapshot;
+	TSharedFuture<void> Encoding;
+};
+
 /**
  * Flow Subsystem
  * - manages lifetime of Flow Graphs
@@ -50,6 +117,10 @@ private:
 	UPROPERTY()
 	TMap<TObjectPtr<UFlowNode_SubGraph>, TObjectPtr<UFlowAsset>> InstancedSubFlows;
 
+	/* Finished instances kept for reuse, up to template's InstancePoolSize. Emptied with the subsystem, as instances are outered to it */
+	UPROPERTY()
+	TMap<TObjectPtr<UFlowAsset>, FFlowInstancePool> InstancePools;
+
 #if !UE_BUILD_SHIPPING
 public:
 	/* Called after creating the first instance of given Flow Asset */
@@ -57,6 +128,9 @@ public:
 
 	/* Called just before removing the last instance of given Flow Asset */
 	static FNativeFlowAssetEvent OnInstancedTemplateRemoved;
+
+	/* Prints node costs gathered with flow.stats.Collect, active instance counts and memory of instanced nodes, used by flow.stats command */
+	virtual void DumpStats(const int32 TopCount, FOutputDevice& Ar) const;
 #endif
 
 protected:
@@ -94,13 +168,32 @@ protected:
 	UFlowAsset* CreateSubFlow(UFlowNode_SubGraph* SubGraphNode, const FString& SavedInstanceName = FString(), const bool bPreloading = false);
 	void RemoveSubFlow(UFlowNode_SubGraph* SubGraphNode, const EFlowFinishPolicy FinishPolicy);
 
+	/* Used for asynchronous loading of Flow content, i.e. SubGraph assets */
+	FStreamableManager StreamableManager;
+
+	/* Resident size of content kept loaded by Content Prefetch of all Flow Asset instances, measured after loading */
+	int64 PrefetchedContentBytes = 0;
+
 public:
+	FStreamableManager& GetStreamableManager() { return StreamableManager; }
+
+	/* False if content already prefetched reached the Content Prefetch memory budget */
+	bool HasPrefetchMemoryBudget() const;
+	void ReservePrefetchMemory(const int64 Bytes);
+	void ReleasePrefetchMemory(const int64 Bytes);
+
 	UFlowAsset* CreateFlowInstance(const TWeakObjectPtr<UObject> Owner, UFlowAsset* LoadedFlowAsset, FString NewInstanceName = FString());
 
 protected:
 	virtual void AddInstancedTemplate(UFlowAsset* Template);
 	virtual void RemoveInstancedTemplate(UFlowAsset* Template);
 
+	/* Returns finished instance of the template, nullptr if there's none */
+	UFlowAsset* TakePooledInstance(UFlowAsset* Template);
+
+	/* Resets deinitialized instance and keeps it for reuse, if the pool has a free slot and all nodes can be pooled */
+	bool TryPoolInstance(UFlowAsset* Template, UFlowAsset& Instance);
+
 public:
 	/* Returns all assets instanced by object from another system like World Settings */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem")
@@ -119,15 +212,66 @@ public:
 
 	virtual UWorld* GetWorld() const override;
 
+//////////////////////////////////////////////////////////////////////////
+// Signal budget
+
+private:
+	/* Asset instances with Queued signals deferred to the next frame */
+	TArray<TWeakObjectPtr<UFlowAsset>> DeferredSignalAssets;
+
+	/* Timer of the world current at the time of deferring, it's gone if that world was torn down before the next tick */
+	FTimerHandle DeferredSignalsTimerHandle;
+
+	uint64 SignalBudgetFrame = 0;
+	uint64 SignalCyclesThisFrame = 0;
+	uint64 SignalExecutionStartCycles = 0;
+	int32 SignalExecutionDepth = 0;
+
+	int32 DeferredSignalsThisFrame = 0;
+	uint64 TotalDeferredSignals = 0;
+
+public:
+	/* Measures time spent on executing signals in the current frame, nested calls are counted once */
+	void BeginSignalExecution();
+	void EndSignalExecution();
+
+	/* Returns false if signals executed in this frame already exceeded Signal Frame Budget set in Flow Settings */
+	bool HasSignalBudget() const;
+
+	/* Asset instance will continue executing its queued signals in the next frame */
+	void DeferSignals(UFlowAsset* FlowAsset);
+
+	/* Number of signals deferred in the current frame */
+	int32 GetDeferredSignalsThisFrame() const { return SignalBudgetFrame == GFrameCounter ? DeferredSignalsThisFrame : 0; }
+
+	/* Number of signals deferred since creating this subsystem, signal deferred multiple times is counted every time */
+	uint64 GetTotalDeferredSignals() const { return TotalDeferredSignals; }
+
+protected:
+	void ExecuteDeferredSignals();
+
 //////////////////////////////////////////////////////////////////////////
 // SaveGame support
 
+public:
 	UPROPERTY(BlueprintAssignable, Category = "FlowSubsystem")
 	FSimpleFlowEvent OnSaveGame;
 
 	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
 	virtual void OnGameSaved(UFlowSaveGame* SaveGame);
 
+	/* Saves Flow records like OnGameSaved, but only captures them on the game thread
+	 * Compression and assembling records happen on a worker thread, SaveGame is complete when OnCompleted is called on the game thread
+	 * SaveGame records must not be accessed until then. Deinitializing the subsystem waits for pending saves and completes them */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
+	void SaveGameAsync(UFlowSaveGame* SaveGame, const FFlowSaveGameEvent& OnCompleted);
+
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem")
+	bool IsSaveGamePending(const UFlowSaveGame* SaveGame) const
+	{
+		return PendingSaveGames.ContainsByPredicate([SaveGame](const FFlowPendingSaveGame& PendingSave) { return PendingSave.SaveGame == SaveGame; });
+	}
+
 	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
 	virtual void OnGameLoaded(UFlowSaveGame* SaveGame);
 
@@ -140,6 +284,41 @@ public:
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem")
 	UFlowSaveGame* GetLoadedSaveGame() const { return LoadedSaveGame; }
 
+	/* Finds the component record in the loaded SaveGame, without scanning all saved components */
+	const FFlowComponentSaveData* FindSavedComponentRecord(const FString& WorldName, const FString& ActorInstanceName);
+
+	/* Finds the Flow Asset instance record in the loaded SaveGame, without scanning all saved instances
+	 * If bMatchWorld is set, only the record saved in the current world is accepted */
+	const FFlowAssetSaveData* FindSavedFlowInstanceRecord(const FString& InstanceName, const bool bMatchWorld);
+
+	/* Drops the lookup index of the loaded SaveGame records, call it after the loaded world finished streaming in
+	 * Index is built again on demand, if any record is requested later */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
+	void ReleaseSaveRecordIndex();
+
+protected:
+	/* Game thread part of saving: calls OnSave on Flow objects, serializes them and moves current SaveGame records to the snapshot */
+	virtual void CaptureSaveSnapshot(UFlowSaveGame* SaveGame, FFlowSaveSnapshot& OutSnapshot);
+
+	/* Moves encoded records back to the SaveGame */
+	static void ApplySaveSnapshot(UFlowSaveGame* SaveGame, FFlowSaveSnapshot& Snapshot);
+
+	/* Waits for encoding of the pending SaveGame, moves its records in and calls OnCompleted */
+	void CompleteSaveGameAsync(const int32 PendingIndex);
+
+	UPROPERTY()
+	TArray<FFlowPendingSaveGame> PendingSaveGames;
+
+	void BuildSaveRecordIndex();
+
+	/* World name -> Actor instance name -> index in LoadedSaveGame->FlowComponents */
+	TMap<FString, TMap<FString, int32>> SavedComponentIndices;
+
+	/* Instance name -> indices in LoadedSaveGame->FlowInstances, in the saved order */
+	TMap<FString, FlowArray::TInlineArray<int32, 1>> SavedFlowInstanceIndices;
+
+	bool bSaveRecordIndexBuilt = false;
+
 //////////////////////////////////////////////////////////////////////////
 // Component Registry
 
@@ -147,6 +326,14 @@ protected:
 	/* All the Flow Components currently existing in the world */
 	TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>> FlowComponentRegistry;
 
+	/* Flow Components keyed by every Identity Tag and all parents of these tags
+	 * Value counts how many Identity Tags of the component are this tag or its children, so removing a single Identity Tag keeps entries added by its siblings
+	 * Used by non-exact queries, so these cost is proportional to the number of matches instead of the size of the registry */
+	TMap<FGameplayTag, TMap<TWeakObjectPtr<UFlowComponent>, int32>> FlowComponentTagHierarchy;
+
+	/* Registry can't be modified while ForEachComponent iterates it */
+	mutable int32 ComponentRegistryIterationDepth = 0;
+
 protected:
 	virtual void RegisterComponent(UFlowComponent* Component);
 	virtual void OnIdentityTagAdded(UFlowComponent* Component, const FGameplayTag& AddedTag);
@@ -156,6 +343,45 @@ protected:
 	virtual void OnIdentityTagRemoved(UFlowComponent* Component, const FGameplayTag& RemovedTag);
 	virtual void OnIdentityTagsRemoved(UFlowComponent* Component, const FGameplayTagContainer& RemovedTags);
 
+	void AddToComponentRegistry(UFlowComponent* Component, const FGameplayTag& Tag);
+	void RemoveFromComponentRegistry(UFlowComponent* Component, const FGameplayTag& Tag);
+
+	/* Broadcast global events and call routed observers */
+	void BroadcastComponentRegistered(UFlowComponent* Component);
+	void BroadcastComponentTagAdded(UFlowComponent* Component, const FGameplayTagContainer& AddedTags);
+	void BroadcastComponentTagRemoved(UFlowComponent* Component, const FGameplayTagContainer& RemovedTags);
+	void BroadcastComponentUnregistered(UFlowComponent* Component, const FGameplayTagContainer& RemovedTags);
+
+//////////////////////////////////////////////////////////////////////////
+// Component Observers
+
+protected:
+	/* Native observers added via AddComponentObserver */
+	TMap<FDelegateHandle, FFlowComponentObserver> ComponentObservers;
+
+	/* Observers requiring exact match, keyed by their routing tags */
+	TMultiMap<FGameplayTag, FDelegateHandle> ExactComponentObservers;
+
+	/* Observers accepting child tags, keyed by their routing tags. Looked up with Identity Tags of the component and all parents of these tags */
+	TMultiMap<FGameplayTag, FDelegateHandle> HierarchicalComponentObservers;
+
+	using FFlowComponentObserverSet = TSet<FDelegateHandle, DefaultKeyFuncs<FDelegateHandle>, TInlineSetAllocator<16>>;
+
+	void GatherComponentObservers(const FGameplayTagContainer& ComponentTags, FFlowComponentObserverSet& OutObservers) const;
+
+public:
+	/**
+	 * Adds native observer, called only for components which Identity Tags can match observer's Identity Tags
+	 * It's much cheaper than binding to global OnComponent* events, as the cost of every registry change is proportional to the number of interested observers
+	 * 
+	 * @param Observer Observer with at least one Identity Tag
+	 * @return Handle required to remove observer
+	 */
+	FDelegateHandle AddComponentObserver(const FFlowComponentObserver& Observer);
+
+	/* Removes observer and resets the handle */
+	void RemoveComponentObserver(FDelegateHandle& Handle);
+
 public:
 	/* Called when actor with Flow Component appears in the world */
 	UPROPERTY(BlueprintAssignable, Category = "FlowSubsystem")
@@ -180,7 +406,7 @@ public:
 	 * 
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ComponentClass Only components matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ComponentClass"))
 	TSet<UFlowComponent*> GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
@@ -191,7 +417,7 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ComponentClass Only components matching this class we'll be returned
-	* @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	* @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ComponentClass"))
 	TSet<UFlowComponent*> GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
@@ -201,7 +427,7 @@ public:
 	 * 
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ActorClass Only actors matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
 	TSet<AActor*> GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
@@ -212,7 +438,7 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ActorClass Only actors matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
 	TSet<AActor*> GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
@@ -222,7 +448,7 @@ public:
 	 * 
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ActorClass Only actors matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
 	TMap<AActor*, UFlowComponent*> GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
@@ -233,37 +459,55 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ActorClass Only actors matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
 	TMap<AActor*, UFlowComponent*> GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
 
+	/**
+	 * Calls given function for every registered Flow Component identified by given tag, without building any intermediate container
+	 * Every component is visited only once. Iteration stops as soon as the function returns false
+	 * Function can't register or unregister components, nor change their Identity Tags. Use GetComponents() with an output array if that's needed
+	 * 
+	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
+	 * @param Func Called for every found component, return false to stop iteration
+	 */
+	void ForEachComponent(const FGameplayTag& Tag, const bool bExactMatch, const TFunctionRef<bool(UFlowComponent*)> Func) const;
+
+	/**
+	 * Calls given function for every registered Flow Component identified by Any or All provided tags, without building any intermediate container
+	 * Every component is visited only once. Iteration stops as soon as the function returns false
+	 * Function can't register or unregister components, nor change their Identity Tags. Use GetComponents() with an output array if that's needed
+	 * 
+	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
+	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
+	 * @param Func Called for every found component, return false to stop iteration
+	 */
+	void ForEachComponent(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, const TFunctionRef<bool(UFlowComponent*)> Func) const;
+
 	/**
 	 * Returns all registered Flow Components identified by given tag
 	 * 
 	 * @tparam T Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class T>
 	TSet<TWeakObjectPtr<T>> GetComponents(const FGameplayTag& Tag, const bool bExactMatch = true) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to GetComponents must be derived from UActorComponent");
 
-		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
-
 		TSet<TWeakObjectPtr<T>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent(Tag, bExactMatch, [&Result](UFlowComponent* Component)
 		{
-			if (Component.IsValid())
+			if (T* ComponentOfClass = Cast<T>(Component))
 			{
-				if (T* ComponentOfClass = Cast<T>(Component))
-				{
-					Result.Emplace(ComponentOfClass);
-				}
+				Result.Emplace(ComponentOfClass);
 			}
-		}
+			return true;
+		});
 
 		return Result;
 	}
@@ -274,57 +518,96 @@ public:
 	 * @tparam T Only components matching this class we'll be returned
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class T>
 	TSet<TWeakObjectPtr<T>> GetComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to GetComponents must be derived from UActorComponent");
 
-		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 		TSet<TWeakObjectPtr<T>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent(Tags, MatchType, bExactMatch, [&Result](UFlowComponent* Component)
 		{
-			if (Component.IsValid())
+			if (T* ComponentOfClass = Cast<T>(Component))
 			{
-				if (T* ComponentOfClass = Cast<T>(Component))
-				{
-					Result.Emplace(ComponentOfClass);
-				}
+				Result.Emplace(ComponentOfClass);
 			}
-		}
+			return true;
+		});
 
 		return Result;
 	}
 
+	/**
+	 * Appends all registered Flow Components identified by given tag to the caller-provided array
+	 * Pass an array with TInlineAllocator to avoid heap allocations for typical queries
+	 * 
+	 * @tparam T Only components matching this class we'll be returned
+	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
+	 * @param OutComponents Array receiving found components, every component is added once
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
+	 */
+	template <class T, typename AllocatorType>
+	void GetComponents(const FGameplayTag& Tag, TArray<TWeakObjectPtr<T>, AllocatorType>& OutComponents, const bool bExactMatch = true) const
+	{
+		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to GetComponents must be derived from UActorComponent");
+
+		ForEachComponent(Tag, bExactMatch, [&OutComponents](UFlowComponent* Component)
+		{
+			if (T* ComponentOfClass = Cast<T>(Component))
+			{
+				OutComponents.Emplace(ComponentOfClass);
+			}
+			return true;
+		});
+	}
+
+	/**
+	 * Appends all registered Flow Components identified by Any or All provided tags to the caller-provided array
+	 * Pass an array with TInlineAllocator to avoid heap allocations for typical queries
+	 * 
+	 * @tparam T Only components matching this class we'll be returned
+	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
+	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
+	 * @param OutComponents Array receiving found components, every component is added once
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
+	 */
+	template <class T, typename AllocatorType>
+	void GetComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, TArray<TWeakObjectPtr<T>, AllocatorType>& OutComponents, const bool bExactMatch = true) const
+	{
+		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to GetComponents must be derived from UActorComponent");
+
+		ForEachComponent(Tags, MatchType, bExactMatch, [&OutComponents](UFlowComponent* Component)
+		{
+			if (T* ComponentOfClass = Cast<T>(Component))
+			{
+				OutComponents.Emplace(ComponentOfClass);
+			}
+			return true;
+		});
+	}
+
 	/**
 	 * Returns all registered Flow Components identified by given tag
 	 * 
 	 * @tparam T Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class T>
 	TSet<TWeakObjectPtr<T>> GetActors(const FGameplayTag& Tag, const bool bExactMatch = true) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const AActor>::Value, "'T' template parameter to GetActors must be derived from AActor");
 
-		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
-
 		TSet<TWeakObjectPtr<T>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent(Tag, bExactMatch, [&Result](UFlowComponent* Component)
 		{
-			if (Component.IsValid())
+			if (T* ActorOfClass = Cast<T>(Component->GetOwner()))
 			{
-				if (T* ActorOfClass = Cast<T>(Component->GetOwner()))
-				{
-					Result.Emplace(ActorOfClass);
-				}
+				Result.Emplace(ActorOfClass);
 			}
-		}
+			return true;
+		});
 
 		return Result;
 	}
@@ -335,27 +618,22 @@ public:
 	 * @tparam T Only actors matching this class we'll be returned
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class T>
 	TSet<TWeakObjectPtr<T>> GetActors(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const AActor>::Value, "'T' template parameter to GetActors must be derived from AActor");
 
-		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 		TSet<TWeakObjectPtr<T>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent(Tags, MatchType, bExactMatch, [&Result](UFlowComponent* Component)
 		{
-			if (Component.IsValid())
+			if (T* ActorOfClass = Cast<T>(Component->GetOwner()))
 			{
-				if (T* ActorOfClass = Cast<T>(Component->GetOwner()))
-				{
-					Result.Emplace(ActorOfClass);
-				}
+				Result.Emplace(ActorOfClass);
 			}
-		}
+			return true;
+		});
 
 		return Result;
 	}
@@ -366,7 +644,7 @@ public:
 	 * @tparam ActorT Only actors matching this class we'll be returned
 	 * @tparam ComponentT Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class ActorT, class ComponentT>
 	TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> GetActorsAndComponents(const FGameplayTag& Tag, const bool bExactMatch = true) const
@@ -374,22 +652,17 @@ public:
 		static_assert(TPointerIsConvertibleFromTo<ActorT, const AActor>::Value, "'ActorT' template parameter to GetActorsAndComponents must be derived from AActor");
 		static_assert(TPointerIsConvertibleFromTo<ComponentT, const UActorComponent>::Value, "'ComponentT' template parameter to GetActorsAndComponents must be derived from UActorComponent");
 
-		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
-
 		TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent(Tag, bExactMatch, [&Result](UFlowComponent* Component)
 		{
-			if (Component.IsValid())
+			ComponentT* ComponentOfClass = Cast<ComponentT>(Component);
+			ActorT* ActorOfClass = Cast<ActorT>(Component->GetOwner());
+			if (ComponentOfClass && ActorOfClass)
 			{
-				ComponentT* ComponentOfClass = Cast<ComponentT>(Component);
-				ActorT* ActorOfClass = Cast<ActorT>(Component->GetOwner());
-				if (ComponentOfClass && ActorOfClass)
-				{
-					Result.Emplace(ActorOfClass, ComponentOfClass);
-				}
+				Result.Emplace(ActorOfClass, ComponentOfClass);
 			}
-		}
+			return true;
+		});
 
 		return Result;
 	}
@@ -401,7 +674,7 @@ public:
 	 * @tparam ComponentT Only components matching this class we'll be returned
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class ActorT, class ComponentT>
 	TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> GetActorsAndComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
@@ -409,27 +682,18 @@ public:
 		static_assert(TPointerIsConvertibleFromTo<ActorT, const AActor>::Value, "'ActorT' template parameter to GetActorsAndComponents must be derived from AActor");
 		static_assert(TPointerIsConvertibleFromTo<ComponentT, const UActorComponent>::Value, "'ComponentT' template parameter to GetActorsAndComponents must be derived from UActorComponent");
 
-		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 		TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent(Tags, MatchType, bExactMatch, [&Result](UFlowComponent* Component)
 		{
-			if (Component.IsValid())
+			ComponentT* ComponentOfClass = Cast<ComponentT>(Component);
+			ActorT* ActorOfClass = Cast<ActorT>(Component->GetOwner());
+			if (ComponentOfClass && ActorOfClass)
 			{
-				ComponentT* ComponentOfClass = Cast<ComponentT>(Component);
-				ActorT* ActorOfClass = Cast<ActorT>(Component->GetOwner());
-				if (ComponentOfClass && ActorOfClass)
-				{
-					Result.Emplace(ActorOfClass, ComponentOfClass);
-				}
+				Result.Emplace(ActorOfClass, ComponentOfClass);
 			}
-		}
+			return true;
+		});
 
 		return Result;
 	}
-
-private:
-	void FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
-	void FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
 };
\ No newline at end of file
@@ -68,6 +68,13 @@ enum class EFlowSignalMode : uint8
 	PassThrough UMETA(ToolTip = "Internal node logic not executed. All connected outputs are triggered, node finishes its work.")
 };
 
+UENUM(BlueprintType)
+enum class EFlowSignalPropagation : uint8
+{
+	Recursive	UMETA(ToolTip = "Default mode, triggering output instantly executes connected input. Every instant node in the chain grows the call stack."),
+	Queued		UMETA(ToolTip = "Triggered outputs are queued on the asset instance and executed in a loop, in the same order as in the Recursive mode. Execution can be limited by the per-frame signal budget.")
+};
+
 UENUM(BlueprintType)
 enum class EFlowNetMode : uint8
 {
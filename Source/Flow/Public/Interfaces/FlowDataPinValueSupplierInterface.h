@@ -5,6 +5,7 @@
 #include "UObject/Interface.h"
 
 #include "Types/FlowDataPinResults.h"
+#include "Types/FlowDataPinTypedRequest.h"
 #include "FlowDataPinValueSupplierInterface.generated.h"
 
 // Interface to define a Flow Data Pin value supplier.  This is generally a UFlowNode subclass, 
@@ -30,4 +31,15 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = DataPins, DisplayName = "Try Supply DataPin")
 	FFlowDataPinResult TrySupplyDataPin(FName PinName) const;
 	virtual FFlowDataPinResult TrySupplyDataPin_Implementation(FName PinName) const { return FFlowDataPinResult(); }
+
+	// Native fast path of TrySupplyDataPin, copying a single value of the requested pin type straight into the caller's storage.
+	// Return FailedUnknownPin only if TrySupplyDataPin would fail for this pin as well, so the next supplier can be asked.
+	// Any other failure makes the caller fall back to TrySupplyDataPin, which handles conversions and reports errors.
+	// Implementers overriding TrySupplyDataPin should override this as well, or keep the default (FailedUnimplemented).
+	virtual EFlowDataPinResolveResult TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const { return EFlowDataPinResolveResult::FailedUnimplemented; }
+
+	// Native only. Provides a stamp that changes whenever the value supplied for this pin might change,
+	// so callers can keep the value resolved from this supplier until the stamp changes.
+	// Return false if the value can change without notice (the default), callers have to resolve it every time then.
+	virtual bool TryGetDataPinValueStamp(const FName& PinName, uint32& OutStamp) const { return false; }
 };
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "UObject/Interface.h"
+#include "Misc/Optional.h"
+#include "Templates/Function.h"
 #include "Templates/SubclassOf.h"
 
 #include "FlowPredicateInterface.generated.h"
@@ -26,5 +28,47 @@ public:
 	bool EvaluatePredicate() const;
 	virtual bool EvaluatePredicate_Implementation() const { return true; }
 
+	// Does this predicate call UFlowNodeAddOn::NotifyPredicateChanged whenever its result might change?
+	// Results of such predicates are cached by their parents, instead of evaluating them on every request
+	// Observable predicates keep state, so they can't be shared templates
+	UFUNCTION(BlueprintNativeEvent)
+	bool IsPredicateObservable() const;
+	virtual bool IsPredicateObservable_Implementation() const { return false; }
+
 	static bool ImplementsInterfaceSafe(const UFlowNodeAddOn* AddOnTemplate);
+	static bool IsPredicateObservableSafe(const UFlowNodeAddOn* AddOn);
+};
+
+/**
+ * Results of child predicates, kept by composite predicates and nodes evaluating predicate AddOns
+ * Results of observable predicates are cached until the child notifies a change, other predicates are evaluated on every request
+ */
+struct FLOW_API FFlowPredicateResultCache
+{
+	bool Evaluate(const UFlowNodeAddOn& Predicate);
+
+	// Are all predicates in the list observable, so their combined result is notified on change too?
+	bool AreAllObservable(const TArray<UFlowNodeAddOn*>& Predicates);
+
+	void Invalidate(const UFlowNodeAddOn& Predicate);
+	void Reset();
+
+	// Invalidates changed child and re-evaluates all children, if they were evaluated before
+	// Returns true if the combined result flipped, so the owner should notify its parent
+	bool HandleChildChanged(const UFlowNodeAddOn& Predicate, TFunctionRef<bool()> EvaluateAll);
+
+	// Combined result of the last evaluation of all children, used to notify only if the result flipped
+	TOptional<bool> LastResult;
+
+private:
+	struct FEntry
+	{
+		bool bObservable = false;
+		bool bHasResult = false;
+		bool bResult = false;
+	};
+
+	FEntry& FindOrAddEntry(const UFlowNodeAddOn& Predicate);
+
+	TMap<const UFlowNodeAddOn*, FEntry> Entries;
 };
@@ -40,6 +40,9 @@ protected:
 
 	TMap<TWeakObjectPtr<AActor>, TWeakObjectPtr<UFlowComponent>> RegisteredActors;
 
+	// Handle of the observer added to the Flow Subsystem, valid while observing
+	FDelegateHandle ComponentObserverHandle;
+
 protected:
 	virtual void ExecuteInput(const FName& PinName) override;
 	virtual void OnLoad_Implementation() override;
@@ -62,7 +62,8 @@ public:
 	// --
 
 	// UFlowNode
-	virtual void GatherPotentialPropertyOwnersForDataPins(TArray<const UObject*>& InOutOwners) const override;
+	virtual bool SupportsTypedDataPinSupply() const override { return true; }
+	virtual void GatherPotentialPropertyOwnersForDataPins(TFlowPropertyOwnerArray& InOutOwners) const override;
 	// --
 
 #if WITH_EDITOR
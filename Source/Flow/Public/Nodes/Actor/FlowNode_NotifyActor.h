@@ -23,8 +23,7 @@ protected:
 	EGameplayContainerMatchType MatchType;
 	/**
 	 * If true, identity tags must be an exact match.
-	 * Be careful, setting this to false may be very expensive, as the
-	 * search cost is proportional to the number of registered Gameplay Tags!
+	 * If false, components identified by child tags of given identity tags will be notified too.
 	 */
 	UPROPERTY(EditAnywhere, Category = "Notify")
 	bool bExactMatch;
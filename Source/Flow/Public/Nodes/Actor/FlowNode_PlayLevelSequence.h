@@ -105,8 +105,11 @@ protected:
 	virtual void OnSave_Implementation() override;
 	virtual void OnLoad_Implementation() override;
 
+public:
+	virtual bool IsSaveDirty() const override;
+
 private:
-	void TriggerEvent(const FString& EventName);
+	void TriggerEvent(const FName& EventName);
 
 public:
 	void OnTimeDilationUpdate(const float NewTimeDilation);
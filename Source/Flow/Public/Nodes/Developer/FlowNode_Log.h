@@ -49,6 +49,11 @@ protected:
 	virtual void ExecuteInput(const FName& PinName) override;
 	// --
 
+public:
+	// UFlowNode
+	virtual bool SupportsTypedDataPinSupply() const override { return true; }
+	// --
+
 #if WITH_EDITOR
 public:
 	// UObject
@@ -16,6 +16,22 @@
 
 #include "FlowNode.generated.h"
 
+class UFlowAsset;
+struct FFlowSharedNodesState;
+
+// Runtime members of UFlowNode, other than properties, kept by every Flow Asset instance for the shared template node
+struct FFlowNodeInstanceState
+{
+	bool bPreloaded = false;
+	bool bSaveDirty = true;
+	TArray<uint8> CachedSaveData;
+
+#if !UE_BUILD_SHIPPING
+	TMap<FName, FPinRecordHistory> InputRecords;
+	TMap<FName, FPinRecordHistory> OutputRecords;
+#endif
+};
+
 /**
  * A Flow Node is UObject-based node designed to handle entire gameplay feature within single node.
  */
@@ -32,6 +48,11 @@ class FLOW_API UFlowNode
 	friend class UFlowAsset;
 	friend class UFlowGraphNode;
 	friend class UFlowNodeAddOn;
+	friend class UFlowNodeBase;
+	friend struct FFlowSharedNodeScope;
+	friend struct FFlowSharedNodesState;
+	friend struct FFlowTrace;
+	friend struct FFlowTraceInputScope;
 	friend class SFlowInputPinHandle;
 	friend class SFlowOutputPinHandle;
 
@@ -168,6 +189,10 @@ protected:
 	UPROPERTY()
 	TMap<FName, FConnectedPin> Connections;
 
+private:
+	// Index of this node in the Execution Table of the asset instance, assigned while initializing instance
+	int32 ExecutionIndex = INDEX_NONE;
+
 public:
 	FConnectedPin GetConnection(const FName OutputName) const { return Connections.FindRef(OutputName); }
 
@@ -237,6 +262,12 @@ public:
 	// IFlowDataPinValueSupplierInterface
 public:
 	virtual FFlowDataPinResult TrySupplyDataPin_Implementation(FName PinName) const override;
+	virtual EFlowDataPinResolveResult TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const override;
+
+	// Opt-in for the typed path of TrySupplyDataPinTyped, which reads values without copying them into FFlowDataPinResult
+	// Return true only if TryFindDataPinValueSourceByPinName finds the same values as TrySupplyDataPin_Implementation and TryFindPropertyByPinName
+	// Subclasses of an opted-in class, changing how values are supplied, have to return false again
+	virtual bool SupportsTypedDataPinSupply() const { return false; }
 
 	// Advanced helper for TrySupplyDataPin, which can be overridden in subclasses to provide alternate sourcing for properties.
 	// If returns true, either OutFoundProperty or OutFoundInstancedStruct is expected to carry the property value.
@@ -247,10 +278,22 @@ public:
 		const FProperty*& OutFoundProperty,
 		TInstancedStruct<FFlowDataPinValue>& OutFoundInstancedStruct) const;
 
+	// Advanced helper for TrySupplyDataPinTyped, the non-copying counterpart of TryFindPropertyByPinName.
+	// Subclasses overriding TryFindPropertyByPinName should override this as well, so both paths find the same value.
+	virtual bool TryFindDataPinValueSourceByPinName(
+		const UObject& PropertyOwnerObject,
+		const FName& PinName,
+		FFlowDataPinValueSource& OutSource) const;
+
 	// Advanced helper for TrySupplyDataPin, which can be overridden in subclasses to provide additional or replacement object(s)
 	// for sourcing the properties for the given pin name. These objects will have PopulateResult called on them.
 	// (this function is used for cases like ExecuteComponent)
-	virtual void GatherPotentialPropertyOwnersForDataPins(TArray<const UObject*>& InOutOwners) const;
+	using TFlowPropertyOwnerArray = FlowArray::TInlineArray<const UObject*, 4>;
+	virtual void GatherPotentialPropertyOwnersForDataPins(TFlowPropertyOwnerArray& InOutOwners) const;
+
+	// Owners added by overrides of this overload are still gathered, base implementation doesn't add this node anymore
+	UE_DEPRECATED(5.5, "Please override GatherPotentialPropertyOwnersForDataPins taking TFlowPropertyOwnerArray instead.")
+	virtual void GatherPotentialPropertyOwnersForDataPins(TArray<const UObject*>& InOutOwners) const {}
 
 	bool TryGatherPropertyOwnersAndPopulateResult(
 		const FName& PinName,
@@ -282,6 +325,13 @@ public:
 		const FName& PinName,
 		TFlowPinValueSupplierDataArray& InOutPinValueSupplierDatas) const;
 
+	// Gathers value stamps of all suppliers of the pin, value resolved for the pin stays valid while these don't change
+	// Returns false if any of suppliers can't provide a stamp, so the value has to be resolved every time
+	using TFlowPinValueSupplierStampArray = FlowArray::TInlineArray<FFlowPinValueSupplierStamp, 4>;
+	bool TryGetFlowDataPinValueStampsForPinName(
+		const FName& PinName,
+		TFlowPinValueSupplierStampArray& OutPinValueSupplierStamps) const;
+
 	// IFlowDataPinGeneratorInterface
 #if WITH_EDITOR
 	virtual void AutoGenerateDataPins(FFlowAutoDataPinsWorkingData& InOutWorkingData) const override;
@@ -301,8 +351,20 @@ protected:
 // Executing node instance
 
 public:
+	// UFlowNodeBase
+	virtual void ResetInstance(const UFlowNodeBase& Template) override;
+	// --
+
 	bool bPreloaded;
 
+private:
+	// Flow Asset instance executing this shared template node at the moment, see UFlowNodeBase::bSharedTemplate
+	UFlowAsset* SharedExecutionInstance = nullptr;
+	TSharedPtr<FFlowSharedNodesState> SharedExecutionState;
+
+	// Exchanges runtime members of this node with the ones kept by Flow Asset instance
+	void SwapInstanceState(FFlowNodeInstanceState& InstanceState);
+
 protected:
 	UPROPERTY(SaveGame)
 	EFlowNodeState ActivationState;
@@ -314,18 +376,28 @@ public:
 #if !UE_BUILD_SHIPPING
 
 protected:
-	TMap<FName, TArray<FPinRecord>> InputRecords;
-	TMap<FName, TArray<FPinRecord>> OutputRecords;
+	TMap<FName, FPinRecordHistory> InputRecords;
+	TMap<FName, FPinRecordHistory> OutputRecords;
 #endif
 
 public:
 	void TriggerPreload();
 	void TriggerFlush();
 
+	// Content loaded asynchronously while this node is close to active nodes, if Content Prefetch is enabled in Flow Settings
+	// By default gathers all soft object and soft class references of this node and its AddOns, including data pin values
+	virtual void GatherPrefetchContent(TArray<FSoftObjectPath>& OutPaths) const;
+
+private:
+	// Soft references don't change at runtime, so properties are iterated once
+	mutable TArray<FSoftObjectPath> PrefetchContentPaths;
+	mutable bool bPrefetchContentGathered = false;
+
 protected:
 
 	// Trigger execution of input pin
 	void TriggerInput(const FName& PinName, const EFlowPinActivationType ActivationType = EFlowPinActivationType::Default);
+	void TriggerInputByIndex(const int32 PinIndex, const EFlowPinActivationType ActivationType = EFlowPinActivationType::Default);
 
 protected:
 	void Deactivate();
@@ -348,6 +420,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FlowNode")
 	void LoadInstance(const FFlowNodeSaveData& NodeRecord);
 
+	// Call after changing SaveGame properties outside of pin activation, so incremental save would serialize this node again
+	UFUNCTION(BlueprintCallable, Category = "FlowNode")
+	void MarkSaveDirty();
+
+	// Should the next incremental save serialize this node, instead of reusing the record cached by the previous save?
+	// Override if OnSave collects data changing on its own, i.e. remaining time of a timer
+	virtual bool IsSaveDirty() const;
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "FlowNode")
 	void OnSave();
@@ -357,6 +437,12 @@ protected:
 
 	UFUNCTION(BlueprintNativeEvent, Category = "FlowNode")
 	void OnPassThrough();
+
+private:
+	// NodeData serialized by the previous incremental save
+	TArray<uint8> CachedSaveData;
+
+	bool bSaveDirty = true;
 	
 //////////////////////////////////////////////////////////////////////////
 // Utils
@@ -367,6 +453,7 @@ public:
 
 	TMap<uint8, FPinRecord> GetWireRecords() const;
 	TArray<FPinRecord> GetPinRecords(const FName& PinName, const EEdGraphPinDirection PinDirection) const;
+	const FPinRecordHistory* FindPinRecordHistory(const FName& PinName, const EEdGraphPinDirection PinDirection) const;
 
 	// Information displayed while node is working - displayed over node as NodeInfoPopup
 	FString GetStatusStringForNodeAndAddOns() const;
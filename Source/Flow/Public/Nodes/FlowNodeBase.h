@@ -39,6 +39,18 @@ struct FFlowPinValueSupplierData
 	const IFlowDataPinValueSupplierInterface* PinValueSupplier = nullptr;
 };
 
+// Supplier + its value stamp (see IFlowDataPinValueSupplierInterface::TryGetDataPinValueStamp)
+struct FFlowPinValueSupplierStamp
+{
+	const IFlowDataPinValueSupplierInterface* PinValueSupplier = nullptr;
+	uint32 Stamp = 0;
+
+	bool operator==(const FFlowPinValueSupplierStamp& Other) const
+	{
+		return PinValueSupplier == Other.PinValueSupplier && Stamp == Other.Stamp;
+	}
+};
+
 /**
  * The base class for UFlowNode and UFlowNodeAddOn, with their shared functionality
  */
@@ -81,6 +93,27 @@ public:
 	virtual void Cleanup() override;
 	// --
 
+	// Can this deinitialized instance be reused by the next instance of the Flow Asset? See UFlowAsset::InstancePoolSize
+	// Override it to return false, if the node keeps state that ResetInstance can't restore
+	virtual bool CanBePooled() const;
+
+	// Restores deinitialized instance to the state of a new instance created from the template
+	// Copies all properties except instanced subobjects, AddOn instances are kept and reset against their templates
+	// Override it to reset native members that aren't properties
+	virtual void ResetInstance(const UFlowNodeBase& Template);
+
+	// Can Flow Asset instances execute against this template node, instead of creating their own instances? See bSharedTemplate
+	virtual bool CanShareTemplate() const;
+
+protected:
+	// Set it in constructor of classes keeping runtime state only in SaveGame properties and not binding to the world, i.e. routing nodes
+	// If enabled in Flow Settings, such nodes execute against the template, while every Flow Asset instance keeps their SaveGame properties
+	// Shared nodes don't receive InitializeInstance and DeinitializeInstance calls. Their AddOns need to be shared too and can't keep any state
+	// SaveGame properties of shared nodes need to be plain data without object references, strings or containers, otherwise the node isn't shared
+	// Shared nodes can't supply data pins to other nodes
+	bool bSharedTemplate = false;
+
+public:
 	// Finish execution of node, it will call Cleanup
 	UFUNCTION(BlueprintCallable, Category = "FlowNode")
 	virtual void Finish() PURE_VIRTUAL(Finish)
@@ -155,6 +188,10 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Instanced, Category = "FlowNode")
 	TArray<TObjectPtr<UFlowNodeAddOn>> AddOns;
 
+private:
+	// Set by ResetInstance, so the next initialization keeps AddOn instances
+	bool bPooledInstance = false;
+
 protected:
 	// FlowNodes and AddOns may determine which AddOns are eligible to be their children
 	// - AddOnTemplate - the template of the FlowNodeAddOn that is being considered to be added as a child
@@ -169,6 +206,10 @@ protected:
 public:
 	virtual const TArray<UFlowNodeAddOn*>& GetFlowNodeAddOnChildren() const { return AddOns; }
 
+	// Called by observable predicate AddOn attached directly to this object, after its result might have changed
+	// Composite predicates re-evaluate and notify their parent if their result flipped, nodes can react instead of polling predicates
+	virtual void OnChildPredicateChanged(UFlowNodeAddOn& Predicate) {}
+
 #if WITH_EDITOR
 	virtual TArray<UFlowNodeAddOn*>& GetFlowNodeAddOnChildrenByEditor() { return MutableView(AddOns); }
 	EFlowAddOnAcceptResult CheckAcceptFlowNodeAddOnChild(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const;
@@ -242,6 +283,10 @@ protected:
 private:
 	UFUNCTION(BlueprintPure, Category = DataPins, DisplayName = "Resolve DataPin By Name")
 	FFlowDataPinResult TryResolveDataPin(FName PinName) const;
+
+	// Resolves a single value through suppliers' typed path, without building FFlowDataPinResult
+	// Returns non-success if any supplier can't use the typed path, so the caller should fall back to TryResolveDataPin
+	EFlowDataPinResolveResult TryResolveDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const;
 	
 public:
 	// Generic single-value resolve & extractor
@@ -481,6 +526,18 @@ protected:
 template <typename TFlowPinType>
 EFlowDataPinResolveResult UFlowNodeBase::TryResolveDataPinValue(const FName& PinName, typename TFlowPinType::ValueType& OutValue, EFlowSingleFromArray SingleFromArray /*= EFlowSingleFromArray::LastValue*/) const
 {
+	if constexpr (FlowPinType::TSupportsTypedSupply<TFlowPinType>::Value)
+	{
+		if (SingleFromArray != EFlowSingleFromArray::EntireArray)
+		{
+			const FFlowDataPinTypedRequest Request = FlowPinType::MakeTypedRequest<TFlowPinType>(OutValue, SingleFromArray);
+			if (FlowPinType::IsSuccess(TryResolveDataPinTyped(PinName, Request)))
+			{
+				return EFlowDataPinResolveResult::Success;
+			}
+		}
+	}
+
 	const FFlowDataPinResult DataPinResult = TryResolveDataPin(PinName);
 	return FlowPinType::TryExtractValue<TFlowPinType>(DataPinResult, OutValue, SingleFromArray);
 }
@@ -384,8 +384,8 @@ enum class EFlowPinActivationType : uint8
 #if !UE_BUILD_SHIPPING
 struct FLOW_API FPinRecord
 {
+	// FApp::GetCurrentTime() of the activation
 	double Time;
-	FString HumanReadableTime;
 	EFlowPinActivationType ActivationType;
 
 	static FString NoActivations;
@@ -396,7 +396,33 @@ struct FLOW_API FPinRecord
 	FPinRecord();
 	FPinRecord(const double InTime, const EFlowPinActivationType InActivationType);
 
+	// Local time of the activation, formatted only when displayed
+	FString GetHumanReadableTime() const;
+};
+
+// Recent activations of a single pin, kept in a ring buffer so long-running graphs don't grow the history without limit
+struct FLOW_API FPinRecordHistory
+{
+	void Add(const FPinRecord& Record, const int32 Capacity);
+
+	int32 Num() const { return Records.Num(); }
+	bool IsEmpty() const { return Records.IsEmpty(); }
+
+	// Number of all activations recorded, including overwritten ones
+	int32 GetTotalNum() const { return TotalNum; }
+
+	// Index 0 is the oldest kept record
+	const FPinRecord& operator[](const int32 Index) const { return Records[(Head + Index) % Records.Num()]; }
+	const FPinRecord& Last() const { return (*this)[Records.Num() - 1]; }
+
+	TArray<FPinRecord> ToArray() const;
+
 private:
-	FORCEINLINE static FString DoubleDigit(const int32 Number);
+	TArray<FPinRecord> Records;
+
+	// Oldest record, once the buffer is full
+	int32 Head = 0;
+
+	int32 TotalNum = 0;
 };
 #endif
@@ -8,6 +8,31 @@
 
 #include "FlowNode_DefineProperties.generated.h"
 
+// Compiled format pattern and resolved named property values, reused by formatting until the value stamps of their suppliers change
+struct FFlowNamedPropertiesFormatCache
+{
+	FTextFormat Format;
+	FFormatNamedArguments Arguments;
+
+	// Per named property, valid only if its value is cached
+	TArray<UFlowNode::TFlowPinValueSupplierStampArray> ArgumentStamps;
+	TBitArray<> CachedArguments;
+
+	FText FormattedText;
+
+	// Changes every time the text is formatted again
+	uint32 FormattedTextStamp = 0;
+
+	uint32 NamedPropertiesStamp = 0;
+	uint16 TextRevision = 0;
+	bool bFormatCompiled = false;
+	bool bFormatted = false;
+
+	bool AreAllArgumentsCached() const { return CachedArguments.Find(false) == INDEX_NONE; }
+
+	void Reset();
+};
+
 /**
  * FlowNode to define data pin property literals for use connecting to data pin inputs in a flow graph
  */
@@ -27,6 +52,18 @@ protected:
 public:
 	virtual void PostLoad() override;
 
+	// UFlowNodeBase
+	virtual void ResetInstance(const UFlowNodeBase& Template) override;
+	// --
+
+	// IFlowDataPinValueSupplierInterface
+	virtual bool TryGetDataPinValueStamp(const FName& PinName, uint32& OutStamp) const override;
+	// --
+
+	// UFlowNode
+	virtual bool SupportsTypedDataPinSupply() const override { return true; }
+	// --
+
 #if WITH_EDITOR
 	// IFlowContextPinSupplierInterface
 	virtual bool SupportsContextPins() const override { return Super::SupportsContextPins() || !NamedProperties.IsEmpty(); }
@@ -47,10 +84,23 @@ public:
 
 	bool TryFormatTextWithNamedPropertiesAsParameters(const FText& FormatText, FText& OutFormattedText) const;
 
+	// Same as above, but reuses the compiled pattern and named property values from the cache, as long as their suppliers report no change
+	bool TryFormatTextWithNamedPropertiesAsParameters(const FText& FormatText, FFlowNamedPropertiesFormatCache& Cache, FText& OutFormattedText) const;
+
+	// Call it after modifying NamedProperties at runtime, it invalidates values cached by this node and its data pin consumers
+	void MarkNamedPropertiesChanged() { ++NamedPropertiesStamp; }
+
 protected:
+	uint32 NamedPropertiesStamp = 1;
+
 	virtual bool TryFindPropertyByPinName(
 		const UObject& PropertyOwnerObject,
 		const FName& PinName,
 		const FProperty*& OutFoundProperty,
 		TInstancedStruct<FFlowDataPinValue>& OutFoundInstancedStruct) const override;
+
+	virtual bool TryFindDataPinValueSourceByPinName(
+		const UObject& PropertyOwnerObject,
+		const FName& PinName,
+		FFlowDataPinValueSource& OutSource) const override;
 };
@@ -22,6 +22,9 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Flow", meta = (DefaultForInputFlowPin, FlowPinType = Text))
 	FText FormatText;
 
+	// Compiled FormatText and argument values, so polling the output pin doesn't format the text again until any input changes
+	mutable FFlowNamedPropertiesFormatCache FormatTextCache;
+
 protected:
 
 #if WITH_EDITOR
@@ -32,8 +35,18 @@ public:
 	EFlowDataPinResolveResult TryResolveFormatText(const FName& PinName, FText& OutFormattedText) const;
 
 public:
+	// UFlowNodeBase
+	virtual void ResetInstance(const UFlowNodeBase& Template) override;
+	// --
+
 	// IFlowDataPinValueSupplierInterface
 	virtual FFlowDataPinResult TrySupplyDataPin_Implementation(FName PinName) const override;
+	virtual EFlowDataPinResolveResult TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const override;
+	virtual bool TryGetDataPinValueStamp(const FName& PinName, uint32& OutStamp) const override;
+	// --
+
+	// UFlowNode
+	virtual bool SupportsTypedDataPinSupply() const override { return true; }
 	// --
 
 	static const FName OUTPIN_TextOutput;
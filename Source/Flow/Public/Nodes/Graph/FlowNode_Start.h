@@ -41,5 +41,11 @@ public:
 
 	// IFlowDataPinValueSupplierInterface
 	virtual FFlowDataPinResult TrySupplyDataPin_Implementation(FName PinName) const override;
+	virtual EFlowDataPinResolveResult TrySupplyDataPinTyped(const FName& PinName, const FFlowDataPinTypedRequest& Request) const override;
+	virtual bool TryGetDataPinValueStamp(const FName& PinName, uint32& OutStamp) const override;
+	// --
+
+	// UFlowNode
+	virtual bool SupportsTypedDataPinSupply() const override { return true; }
 	// --
 };
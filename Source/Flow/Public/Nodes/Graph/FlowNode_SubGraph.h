@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Engine/StreamableManager.h"
 #include "Nodes/FlowNode.h"
 
 #include "FlowNode_SubGraph.generated.h"
@@ -38,18 +39,36 @@ private:
 	UPROPERTY(SaveGame)
 	FString SavedAssetInstanceName;
 
+	// Inputs triggered while the asset was loading asynchronously, executed in the same order once it's loaded
+	UPROPERTY(SaveGame)
+	TArray<FName> PendingInputs;
+
+	// Keeps the asset loaded, from requesting the asynchronous load until the SubGraph is instanced or flushed
+	TSharedPtr<FStreamableHandle> AssetLoadHandle;
+
 protected:
 	virtual bool CanBeAssetInstanced() const;
 
 	virtual void PreloadContent() override;
 	virtual void FlushContent() override;
 
+	virtual void DeinitializeInstance() override;
+
 	virtual void ExecuteInput(const FName& PinName) override;
 	virtual void Cleanup() override;
 
 public:
 	virtual void ForceFinishNode() override;
 
+	// Starts loading the asset asynchronously, unless it's already loaded or loading
+	void RequestAssetLoad();
+
+	bool IsAssetLoadPending() const { return AssetLoadHandle.IsValid() && AssetLoadHandle->IsLoadingInProgress(); }
+
+protected:
+	void OnAssetLoaded();
+	void ReleaseAssetLoadHandle();
+
 protected:
 	virtual void OnLoad_Implementation() override;
 
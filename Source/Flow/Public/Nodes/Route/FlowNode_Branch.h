@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Nodes/FlowNode.h"
+#include "Interfaces/FlowPredicateInterface.h"
 
 #include "FlowNode_Branch.generated.h"
 
@@ -16,6 +17,11 @@ public:
 
 	// UFlowNodeBase
 	virtual EFlowAddOnAcceptResult AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const override;
+	virtual void OnChildPredicateChanged(UFlowNodeAddOn& Predicate) override;
+	// --
+
+	// IFlowCoreExecutableInterface
+	virtual void DeinitializeInstance() override;
 	// --
 
 	// Event reacting on triggering Input pin
@@ -24,4 +30,8 @@ public:
 	static const FName INPIN_Evaluate;
 	static const FName OUTPIN_True;
 	static const FName OUTPIN_False;
+
+protected:
+	// Results of observable predicates, so repeated evaluations don't call into unchanged predicates
+	FFlowPredicateResultCache PredicateCache;
 };
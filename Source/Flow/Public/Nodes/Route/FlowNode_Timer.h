@@ -41,6 +41,9 @@ private:
 	UPROPERTY(SaveGame)
 	float RemainingStepTime;
 
+public:
+	virtual bool SupportsTypedDataPinSupply() const override { return true; }
+
 protected:
 	virtual void InitializeInstance() override;
 	virtual void ExecuteInput(const FName& PinName) override;
@@ -62,6 +65,11 @@ protected:
 
 	virtual void OnSave_Implementation() override;
 	virtual void OnLoad_Implementation() override;
+
+public:
+	virtual bool IsSaveDirty() const override;
+
+protected:
 	
 #if WITH_EDITOR
 public:
@@ -0,0 +1,113 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+// Projects can disable per-node cost tracking by defining FLOW_STATS_ENABLED=0 in the target rules
+#ifndef FLOW_STATS_ENABLED
+#define FLOW_STATS_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+DECLARE_STATS_GROUP(TEXT("Flow"), STATGROUP_Flow, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Node Execute Input"), STAT_FlowNode_ExecuteInput, STATGROUP_Flow, FLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Node Activate"), STAT_FlowNode_Activate, STATGROUP_Flow, FLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Node Cleanup"), STAT_FlowNode_Cleanup, STATGROUP_Flow, FLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Node Resolve Data Pin"), STAT_FlowNode_ResolveDataPin, STATGROUP_Flow, FLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Node Save"), STAT_FlowNode_Save, STATGROUP_Flow, FLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Node Load"), STAT_FlowNode_Load, STATGROUP_Flow, FLOW_API);
+
+#if FLOW_STATS_ENABLED
+
+class FOutputDevice;
+class UFlowNodeBase;
+
+enum class EFlowNodeStatsCategory : uint8
+{
+	ExecuteInput,
+	Activate,
+	Cleanup,
+	ResolveDataPin,
+	Save,
+	Load,
+
+	Max
+};
+
+/**
+ * Cost of Flow Node calls, aggregated by node class and by template asset
+ * Collection is disabled by default, enable it with flow.stats.Collect 1 and print results with flow.stats
+ * Recorded time is exclusive: time spent in nested node calls is attributed only to the nested node
+ */
+struct FLOW_API FFlowNodeStats
+{
+	struct FEntry
+	{
+		FString Name;
+		uint64 Calls[static_cast<uint8>(EFlowNodeStatsCategory::Max)] = {};
+		uint64 TotalCycles[static_cast<uint8>(EFlowNodeStatsCategory::Max)] = {};
+		uint64 MaxCycles[static_cast<uint8>(EFlowNodeStatsCategory::Max)] = {};
+
+		uint64 GetCalls() const;
+		uint64 GetTotalCycles() const;
+		uint64 GetMaxCycles() const;
+	};
+
+	static bool IsCollecting() { return bCollecting && IsInGameThread(); }
+
+	static void Record(const UFlowNodeBase& Node, const EFlowNodeStatsCategory Category, const uint64 Cycles);
+	static void Reset();
+
+	// Prints up to TopCount node classes and template assets, sorted by cumulative time and by longest single call
+	static void Dump(const int32 TopCount, FOutputDevice& Ar);
+
+	static const TCHAR* GetCategoryName(const EFlowNodeStatsCategory Category);
+
+	// Bound to flow.stats.Collect
+	static bool bCollecting;
+};
+
+// Measures a single node call, if collection is enabled
+struct FLOW_API FFlowNodeStatsScope
+{
+	FFlowNodeStatsScope(const UFlowNodeBase& InNode, const EFlowNodeStatsCategory InCategory)
+	{
+		if (FFlowNodeStats::IsCollecting())
+		{
+			Begin(InNode, InCategory);
+		}
+	}
+
+	~FFlowNodeStatsScope()
+	{
+		if (Node)
+		{
+			End();
+		}
+	}
+
+	UE_NONCOPYABLE(FFlowNodeStatsScope);
+
+private:
+	void Begin(const UFlowNodeBase& InNode, const EFlowNodeStatsCategory InCategory);
+	void End();
+
+	const UFlowNodeBase* Node = nullptr;
+	FFlowNodeStatsScope* Parent = nullptr;
+	uint64 StartCycles = 0;
+	uint64 ChildCycles = 0;
+	EFlowNodeStatsCategory Category = EFlowNodeStatsCategory::Max;
+
+	static FFlowNodeStatsScope* Current;
+};
+
+#define FLOW_NODE_STATS_SCOPE(Node, Category) \
+	SCOPE_CYCLE_COUNTER(STAT_FlowNode_##Category); \
+	const FFlowNodeStatsScope ANONYMOUS_VARIABLE(FlowNodeStatsScope_)(Node, EFlowNodeStatsCategory::Category)
+
+#else
+
+#define FLOW_NODE_STATS_SCOPE(Node, Category) SCOPE_CYCLE_COUNTER(STAT_FlowNode_##Category)
+
+#endif
@@ -0,0 +1,75 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Trace/Config.h"
+
+// Projects can disable Flow tracing by defining FLOW_TRACE_ENABLED=0 in the target rules
+#ifndef FLOW_TRACE_ENABLED
+#define FLOW_TRACE_ENABLED UE_TRACE_ENABLED
+#endif
+
+#if FLOW_TRACE_ENABLED
+
+#include "Trace/Trace.h"
+
+class UFlowAsset;
+class UFlowNode;
+enum class EFlowPinActivationType : uint8;
+
+UE_TRACE_CHANNEL_EXTERN(FlowChannel, FLOW_API);
+
+/**
+ * Emits Flow execution events to Unreal Insights, enabled by -trace=flow
+ * Events identify assets and nodes by numbers: instance and template by UObject unique ID, node by its Execution Table index
+ * Names are sent once per template as important events, so late-connected sessions receive them as well
+ */
+struct FLOW_API FFlowTrace
+{
+	static void OutputInstanceCreated(const UFlowAsset& Instance);
+	static void OutputInstanceStarted(const UFlowAsset& Instance);
+	static void OutputInstanceFinished(const UFlowAsset& Instance);
+	static void OutputInstanceRemoved(const UFlowAsset& Instance);
+
+	static void OutputPinTriggered(const UFlowNode& Node, const int32 PinIndex, const EFlowPinActivationType ActivationType);
+
+private:
+	static void OutputTemplateSpec(const UFlowAsset& Template);
+};
+
+// Traces handling of a triggered input, including execution of pins triggered by it
+struct FLOW_API FFlowTraceInputScope
+{
+	FFlowTraceInputScope(const UFlowNode& InNode, const int32 InPinIndex, const EFlowPinActivationType InActivationType);
+	~FFlowTraceInputScope();
+
+	UE_NONCOPYABLE(FFlowTraceInputScope);
+
+private:
+	uint64 StartCycle = 0;
+	uint32 InstanceId = 0;
+	int32 NodeIndex = INDEX_NONE;
+	int32 PinIndex = 0;
+	EFlowPinActivationType ActivationType;
+	bool bEnabled = false;
+
+	static uint16 Depth;
+};
+
+#define FLOW_TRACE_INSTANCE_CREATED(Instance) FFlowTrace::OutputInstanceCreated(Instance)
+#define FLOW_TRACE_INSTANCE_STARTED(Instance) FFlowTrace::OutputInstanceStarted(Instance)
+#define FLOW_TRACE_INSTANCE_FINISHED(Instance) FFlowTrace::OutputInstanceFinished(Instance)
+#define FLOW_TRACE_INSTANCE_REMOVED(Instance) FFlowTrace::OutputInstanceRemoved(Instance)
+#define FLOW_TRACE_OUTPUT_TRIGGERED(Node, PinIndex, ActivationType) FFlowTrace::OutputPinTriggered(Node, PinIndex, ActivationType)
+#define FLOW_TRACE_INPUT_SCOPE(Node, PinIndex, ActivationType) const FFlowTraceInputScope ANONYMOUS_VARIABLE(FlowTraceInputScope_)(Node, PinIndex, ActivationType)
+
+#else
+
+#define FLOW_TRACE_INSTANCE_CREATED(Instance)
+#define FLOW_TRACE_INSTANCE_STARTED(Instance)
+#define FLOW_TRACE_INSTANCE_FINISHED(Instance)
+#define FLOW_TRACE_INSTANCE_REMOVED(Instance)
+#define FLOW_TRACE_OUTPUT_TRIGGERED(Node, PinIndex, ActivationType)
+#define FLOW_TRACE_INPUT_SCOPE(Node, PinIndex, ActivationType)
+
+#endif
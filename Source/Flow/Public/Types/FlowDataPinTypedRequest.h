@@ -0,0 +1,43 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Types/FlowPinEnums.h"
+#include "Types/FlowPinTypeName.h"
+
+class FProperty;
+struct FFlowDataPinValue;
+
+// Memory holding a data pin value, found without copying it.
+// Either DataPinValue is set, or Property with its Container.
+struct FFlowDataPinValueSource
+{
+	const FFlowDataPinValue* DataPinValue = nullptr;
+
+	const FProperty* Property = nullptr;
+	const void* Container = nullptr;
+
+	bool IsValid() const { return DataPinValue != nullptr || (Property != nullptr && Container != nullptr); }
+};
+
+/**
+ * Request to supply a single data pin value of known pin type directly into the caller's storage.
+ * Used by the typed data pin path, which avoids building FFlowDataPinResult and temporary arrays for simple pin types.
+ * Created by FlowPinType::MakeTypedRequest<TPinType>, so OutValue always points to TPinType::ValueType.
+ */
+struct FFlowDataPinTypedRequest
+{
+	using FCopyValueFunction = EFlowDataPinResolveResult(*)(const FFlowDataPinValueSource& Source, EFlowSingleFromArray SingleFromArray, void* OutValue);
+
+	FFlowPinTypeName PinTypeName;
+	EFlowSingleFromArray SingleFromArray = EFlowSingleFromArray::LastValue;
+	void* OutValue = nullptr;
+
+	// Copies value only if the source holds exactly the requested pin type, no conversions are made here
+	FCopyValueFunction CopyValueFunction = nullptr;
+
+	EFlowDataPinResolveResult CopyValue(const FFlowDataPinValueSource& Source) const
+	{
+		return CopyValueFunction(Source, SingleFromArray, OutValue);
+	}
+};
@@ -0,0 +1,55 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "Types/FlowPinTypeName.h"
+#include "UObject/ObjectKey.h"
+
+class FProperty;
+class UClass;
+class UObject;
+class UScriptStruct;
+
+// Property matching the data pin name, resolved once per class
+struct FFlowCachedPinProperty
+{
+	const FProperty* Property = nullptr;
+
+	// Set only if the property is a FFlowDataPinValue struct
+	const UScriptStruct* DataPinValueStruct = nullptr;
+	FFlowPinTypeName PinTypeName;
+
+	int32 Offset = 0;
+
+	bool IsValid() const { return Property != nullptr; }
+
+	const void* GetValuePtr(const UObject& PropertyOwnerObject) const
+	{
+		return reinterpret_cast<const uint8*>(&PropertyOwnerObject) + Offset;
+	}
+};
+
+/**
+ * Per-class cache of properties supplying data pins, so resolving a pin doesn't search class properties by name
+ * Missing properties are cached too. Cache is flushed after hot reload and Blueprint reinstancing, as these change class layout
+ * Game thread only
+ */
+class FLOW_API FFlowPinPropertyCache
+{
+public:
+	static FFlowCachedPinProperty FindProperty(const UClass& Class, const FName& PinName);
+
+	static void Flush();
+
+	static void RegisterDelegates();
+	static void UnregisterDelegates();
+
+private:
+	static TMap<FObjectKey, TMap<FName, FFlowCachedPinProperty>> ClassProperties;
+
+	static FDelegateHandle ReloadCompleteHandle;
+#if WITH_EDITOR
+	static FDelegateHandle ObjectsReinstancedHandle;
+#endif
+};
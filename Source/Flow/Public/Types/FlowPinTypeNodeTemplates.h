@@ -29,7 +29,7 @@ namespace FlowPinType
 
 		if (ValueStruct.IsValid() && ValueStruct.Get<FFlowDataPinValue>().GetPinTypeName() == TPinType::GetPinTypeNameStatic())
 		{
-			OutResult.ResultValue = ValueStruct;
+			OutResult.ResultValue = MoveTemp(ValueStruct);
 			OutResult.Result = EFlowDataPinResolveResult::Success;
 			return true;
 		}
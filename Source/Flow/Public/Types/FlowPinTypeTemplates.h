@@ -13,6 +13,7 @@
 #include "UObject/UnrealType.h"
 #include "Types/FlowDataPinValuesStandard.h"
 #include "Types/FlowDataPinResults.h"
+#include "Types/FlowDataPinTypedRequest.h"
 #include "FlowLogChannels.h"
 #include <limits>
 #include <type_traits>
@@ -1022,4 +1023,90 @@ namespace FlowPinType
 		const FFlowDataPinValue_Enum& Wrapper = DataPinResult.ResultValue.Get<FFlowDataPinValue_Enum>();
 		return Wrapper.TryGetAllNativeEnumValues(OutValues);
 	}
+
+	// -----------------------------------------------------------------------
+	// Typed Supply
+	// -----------------------------------------------------------------------
+
+	// Pin types which wrappers store TArray<ValueType>, so a single value can be copied into caller's storage as-is
+	template <typename TPinType>
+	struct TSupportsTypedSupply
+	{
+		static constexpr bool Value =
+			std::is_same_v<TPinType, FFlowPinType_Bool> ||
+			std::is_same_v<TPinType, FFlowPinType_Int> ||
+			std::is_same_v<TPinType, FFlowPinType_Int64> ||
+			std::is_same_v<TPinType, FFlowPinType_Float> ||
+			std::is_same_v<TPinType, FFlowPinType_Double> ||
+			std::is_same_v<TPinType, FFlowPinType_Name> ||
+			std::is_same_v<TPinType, FFlowPinType_String> ||
+			std::is_same_v<TPinType, FFlowPinType_Text> ||
+			std::is_same_v<TPinType, FFlowPinType_Vector> ||
+			std::is_same_v<TPinType, FFlowPinType_Rotator> ||
+			std::is_same_v<TPinType, FFlowPinType_Transform> ||
+			std::is_same_v<TPinType, FFlowPinType_GameplayTag>;
+	};
+
+	// Copies a single value from the wrapper or the direct property of exactly TPinType
+	// Anything else (cross-type conversions, legacy wrappers, array properties) is left to the FFlowDataPinResult path
+	template <typename TPinType>
+	EFlowDataPinResolveResult CopySingleValueFromSource(const FFlowDataPinValueSource& Source, EFlowSingleFromArray SingleFromArray, void* OutValue)
+	{
+		using ValueType = typename TPinType::ValueType;
+		using WrapperType = typename TPinType::WrapperType;
+		using PropertyType = typename TPinType::MainPropertyType;
+
+		ValueType& OutTypedValue = *static_cast<ValueType*>(OutValue);
+
+		if (Source.DataPinValue)
+		{
+			if (!(Source.DataPinValue->GetPinTypeName() == TPinType::GetPinTypeNameStatic()))
+			{
+				return EFlowDataPinResolveResult::FailedMismatchedType;
+			}
+
+			const TArray<ValueType>& Values = static_cast<const WrapperType*>(Source.DataPinValue)->Values;
+			const int32 Index = EFlowSingleFromArray_Classifiers::ConvertToIndex(SingleFromArray, Values.Num());
+			if (!Values.IsValidIndex(Index))
+			{
+				return EFlowDataPinResolveResult::FailedInsufficientValues;
+			}
+
+			OutTypedValue = Values[Index];
+			return EFlowDataPinResolveResult::Success;
+		}
+
+		if (const PropertyType* Prop = CastField<PropertyType>(Source.Property))
+		{
+			if constexpr (std::is_same_v<PropertyType, FStructProperty>)
+			{
+				if (Prop->Struct == TBaseStructure<ValueType>::Get())
+				{
+					OutTypedValue = *Prop->template ContainerPtrToValuePtr<ValueType>(Source.Container);
+					return EFlowDataPinResolveResult::Success;
+				}
+			}
+			else
+			{
+				OutTypedValue = Prop->GetPropertyValue_InContainer(Source.Container);
+				return EFlowDataPinResolveResult::Success;
+			}
+		}
+
+		return EFlowDataPinResolveResult::FailedMismatchedType;
+	}
+
+	template <typename TPinType>
+	FFlowDataPinTypedRequest MakeTypedRequest(typename TPinType::ValueType& OutValue, EFlowSingleFromArray SingleFromArray)
+	{
+		static_assert(TSupportsTypedSupply<TPinType>::Value, "Pin type doesn't support typed supply");
+		check(SingleFromArray != EFlowSingleFromArray::EntireArray);
+
+		FFlowDataPinTypedRequest Request;
+		Request.PinTypeName = TPinType::GetPinTypeNameStatic();
+		Request.SingleFromArray = SingleFromArray;
+		Request.OutValue = &OutValue;
+		Request.CopyValueFunction = &CopySingleValueFromSource<TPinType>;
+		return Request;
+	}
 }
\ No newline at end of file
@@ -36,16 +36,29 @@ bool UFlowDebuggerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 
 void UFlowDebuggerSubsystem::OnInstancedTemplateAdded(UFlowAsset* AssetTemplate)
 {
-	AssetTemplate->OnPinTriggered.BindUObject(this, &ThisClass::OnPinTriggered);
+	FTemplateBreakpoints& Entry = TemplateBreakpoints.FindOrAdd(AssetTemplate);
+	Entry.AssetTemplate = AssetTemplate;
+	RefreshTemplateBreakpoints(Entry);
 }
 
-void UFlowDebuggerSubsystem::OnInstancedTemplateRemoved(UFlowAsset* AssetTemplate) const
+void UFlowDebuggerSubsystem::OnInstancedTemplateRemoved(UFlowAsset* AssetTemplate)
 {
-	AssetTemplate->OnPinTriggered.Unbind();
+	FTemplateBreakpoints Entry;
+	if (TemplateBreakpoints.RemoveAndCopyValue(AssetTemplate, Entry))
+	{
+		AssetTemplate->OnPinTriggered.Remove(Entry.PinTriggeredHandle);
+	}
 }
 
-void UFlowDebuggerSubsystem::OnPinTriggered(const FGuid& NodeGuid, const FName& PinName)
+void UFlowDebuggerSubsystem::OnPinTriggered(const UFlowAsset* Instance, const FGuid& NodeGuid, const FName& PinName)
 {
+	// we're bound only to templates with breakpoints, but not every node of such template has one
+	const FTemplateBreakpoints* Entry = TemplateBreakpoints.Find(Instance->GetTemplateAsset());
+	if (Entry == nullptr || !Entry->NodeGuids.Contains(NodeGuid))
+	{
+		return;
+	}
+
 	if (FindBreakpoint(NodeGuid, PinName))
 	{
 		MarkAsHit(NodeGuid, PinName);
@@ -55,6 +68,45 @@ void UFlowDebuggerSubsystem::OnPinTriggered(const FGuid& NodeGuid, const FName&
 	MarkAsHit(NodeGuid);
 }
 
+void UFlowDebuggerSubsystem::RefreshTemplateBreakpoints()
+{
+	for (TPair<TObjectKey<UFlowAsset>, FTemplateBreakpoints>& Pair : TemplateBreakpoints)
+	{
+		RefreshTemplateBreakpoints(Pair.Value);
+	}
+}
+
+void UFlowDebuggerSubsystem::RefreshTemplateBreakpoints(FTemplateBreakpoints& Entry)
+{
+	UFlowAsset* AssetTemplate = Entry.AssetTemplate.Get();
+	if (AssetTemplate == nullptr)
+	{
+		return;
+	}
+
+	const UFlowDebuggerSettings* Settings = GetDefault<UFlowDebuggerSettings>();
+
+	Entry.NodeGuids.Reset();
+	for (const TPair<FGuid, UFlowNode*>& Node : AssetTemplate->GetNodes())
+	{
+		if (Settings->NodeBreakpoints.Contains(Node.Key))
+		{
+			Entry.NodeGuids.Add(Node.Key);
+		}
+	}
+
+	const bool bBound = Entry.PinTriggeredHandle.IsValid();
+	if (Entry.NodeGuids.Num() > 0 && !bBound)
+	{
+		Entry.PinTriggeredHandle = AssetTemplate->OnPinTriggered.AddUObject(this, &ThisClass::OnPinTriggered);
+	}
+	else if (Entry.NodeGuids.IsEmpty() && bBound)
+	{
+		AssetTemplate->OnPinTriggered.Remove(Entry.PinTriggeredHandle);
+		Entry.PinTriggeredHandle.Reset();
+	}
+}
+
 void UFlowDebuggerSubsystem::AddBreakpoint(const FGuid& NodeGuid)
 {
 	UFlowDebuggerSettings* Settings = GetMutableDefault<UFlowDebuggerSettings>();
@@ -352,4 +404,6 @@ void UFlowDebuggerSubsystem::SaveSettings()
 {
 	UFlowDebuggerSettings* Settings = GetMutableDefault<UFlowDebuggerSettings>();
 	Settings->SaveConfig();
+
+	RefreshTemplateBreakpoints();
 }
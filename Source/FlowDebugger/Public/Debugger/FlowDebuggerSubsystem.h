@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
 
 #include "Debugger/FlowDebuggerTypes.h"
 #include "FlowDebuggerSubsystem.generated.h"
@@ -25,10 +26,28 @@ public:
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
 
 protected:
+	struct FTemplateBreakpoints
+	{
+		TWeakObjectPtr<UFlowAsset> AssetTemplate;
+
+		// Nodes of this template with any breakpoint set
+		TSet<FGuid> NodeGuids;
+
+		// Valid only while NodeGuids isn't empty, so instances without breakpoints don't notify the debugger
+		FDelegateHandle PinTriggeredHandle;
+	};
+
+	/* Instanced templates, with breakpoints precomputed from settings */
+	TMap<TObjectKey<UFlowAsset>, FTemplateBreakpoints> TemplateBreakpoints;
+
 	virtual void OnInstancedTemplateAdded(UFlowAsset* AssetTemplate);
-	virtual void OnInstancedTemplateRemoved(UFlowAsset* AssetTemplate) const;
+	virtual void OnInstancedTemplateRemoved(UFlowAsset* AssetTemplate);
+
+	virtual void OnPinTriggered(const UFlowAsset* Instance, const FGuid& NodeGuid, const FName& PinName);
 
-	virtual void OnPinTriggered(const FGuid& NodeGuid, const FName& PinName);
+	/* Rebuilds breakpoint sets of instanced templates, called after modifying breakpoints */
+	virtual void RefreshTemplateBreakpoints();
+	void RefreshTemplateBreakpoints(FTemplateBreakpoints& Entry);
 
 public:
 	virtual void AddBreakpoint(const FGuid& NodeGuid);
@@ -1092,20 +1092,25 @@ void UFlowGraphNode::GetPinHoverText(const UEdGraphPin& Pin, FString& HoverTextO
 				HoverTextOut.Append(LINE_TERMINATOR).Append(LINE_TERMINATOR);
 			}
 
-			const TArray<FPinRecord>& PinRecords = InspectedNodeInstance->GetPinRecords(Pin.PinName, Pin.Direction);
-			if (PinRecords.Num() == 0)
+			const FPinRecordHistory* PinRecords = InspectedNodeInstance->FindPinRecordHistory(Pin.PinName, Pin.Direction);
+			if (PinRecords == nullptr || PinRecords->IsEmpty())
 			{
 				HoverTextOut.Append(FPinRecord::NoActivations);
 			}
 			else
 			{
 				HoverTextOut.Append(FPinRecord::PinActivations);
-				for (int32 i = 0; i < PinRecords.Num(); i++)
+
+				// numbering continues from activations that are no longer kept
+				const int32 FirstActivationNumber = PinRecords->GetTotalNum() - PinRecords->Num() + 1;
+				for (int32 i = 0; i < PinRecords->Num(); i++)
 				{
+					const FPinRecord& PinRecord = (*PinRecords)[i];
+
 					HoverTextOut.Append(LINE_TERMINATOR);
-					HoverTextOut.Appendf(TEXT("%d) %s"), i + 1, *PinRecords[i].HumanReadableTime);
+					HoverTextOut.Appendf(TEXT("%d) %s"), FirstActivationNumber + i, *PinRecord.GetHumanReadableTime());
 
-					switch (PinRecords[i].ActivationType)
+					switch (PinRecord.ActivationType)
 					{
 						case EFlowPinActivationType::Default:
 							break;
@@ -1126,7 +1131,9 @@ void UFlowGraphNode::GetPinHoverText(const UEdGraphPin& Pin, FString& HoverTextO
 
 void UFlowGraphNode::ForcePinActivation(const FEdGraphPinReference PinReference) const
 {
-	UFlowNode* InspectedNodeInstance = GetInspectedNodeInstance();
+	const UFlowNode* FlowNode = Cast<UFlowNode>(NodeInstance);
+	UFlowAsset* InspectedAssetInstance = FlowNode ? FlowNode->GetFlowAsset()->GetInspectedInstance() : nullptr;
+	UFlowNode* InspectedNodeInstance = InspectedAssetInstance ? InspectedAssetInstance->GetNode(FlowNode->GetGuid()) : nullptr;
 	if (InspectedNodeInstance == nullptr)
 	{
 		return;
@@ -1134,6 +1141,9 @@ void UFlowGraphNode::ForcePinActivation(const FEdGraphPinReference PinReference)
 
 	if (const UEdGraphPin* FoundPin = PinReference.Get())
 	{
+		// shared template node has to execute with the state of the inspected instance
+		const FFlowSharedNodeScope SharedNodeScope(*InspectedAssetInstance, *InspectedNodeInstance);
+
 		switch (FoundPin->Direction)
 		{
 			case EGPD_Input:
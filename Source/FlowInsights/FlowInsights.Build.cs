@@ -0,0 +1,21 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+using UnrealBuildTool;
+
+public class FlowInsights : ModuleRules
+{
+	public FlowInsights(ReadOnlyTargetRules target) : base(target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new[]
+		{
+			"Core",
+			"Slate",
+			"SlateCore",
+			"TraceAnalysis",
+			"TraceInsights",
+			"TraceServices"
+		});
+	}
+}
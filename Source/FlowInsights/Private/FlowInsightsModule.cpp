@@ -0,0 +1,28 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowInsightsModule.h"
+#include "FlowTimingViewExtender.h"
+#include "FlowTraceModule.h"
+
+#include "Features/IModularFeatures.h"
+#include "Modules/ModuleManager.h"
+
+void FFlowInsightsModule::StartupModule()
+{
+	TraceModule = MakeShared<FFlowTraceModule>();
+	IModularFeatures::Get().RegisterModularFeature(TraceServices::ModuleFeatureName, TraceModule.Get());
+
+	TimingViewExtender = MakeShared<FFlowTimingViewExtender>();
+	IModularFeatures::Get().RegisterModularFeature(UE::Insights::Timing::TimingViewExtenderFeatureName, TimingViewExtender.Get());
+}
+
+void FFlowInsightsModule::ShutdownModule()
+{
+	IModularFeatures::Get().UnregisterModularFeature(UE::Insights::Timing::TimingViewExtenderFeatureName, TimingViewExtender.Get());
+	TimingViewExtender.Reset();
+
+	IModularFeatures::Get().UnregisterModularFeature(TraceServices::ModuleFeatureName, TraceModule.Get());
+	TraceModule.Reset();
+}
+
+IMPLEMENT_MODULE(FFlowInsightsModule, FlowInsights)
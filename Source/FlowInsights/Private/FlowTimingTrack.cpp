@@ -0,0 +1,137 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowTimingTrack.h"
+#include "FlowTraceProvider.h"
+
+#include "Insights/ViewModels/ITimingViewDrawHelper.h"
+#include "Insights/ViewModels/TimingEvent.h"
+#include "Insights/ViewModels/TimingEventSearch.h"
+#include "Insights/ViewModels/TimingTrackViewport.h"
+#include "Insights/ViewModels/TooltipDrawState.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+INSIGHTS_IMPLEMENT_RTTI(FFlowTimingTrack)
+
+FFlowTimingTrack::FFlowTimingTrack(const TraceServices::IAnalysisSession& InAnalysisSession, const uint32 InTemplateId, const FString& InTemplateName)
+	: FTimingEventsTrack(FString::Printf(TEXT("Flow - %s"), *InTemplateName))
+	, AnalysisSession(InAnalysisSession)
+	, TemplateId(InTemplateId)
+{
+}
+
+void FFlowTimingTrack::Update(const FFlowTraceTemplate& Template)
+{
+	const FString TrackName = FString::Printf(TEXT("Flow - %s (%.3f ms)"), *Template.Name, Template.TotalTime * 1000.0);
+	if (GetName() != TrackName)
+	{
+		SetName(TrackName);
+	}
+
+	if (ScopesNum != Template.ScopesNum)
+	{
+		ScopesNum = Template.ScopesNum;
+		SetDirtyFlag();
+	}
+}
+
+void FFlowTimingTrack::BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context)
+{
+	const FTimingTrackViewport& Viewport = Context.GetViewport();
+
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(AnalysisSession);
+
+	const FFlowTraceProvider* Provider = AnalysisSession.ReadProvider<FFlowTraceProvider>(FFlowTraceProvider::ProviderName);
+	const FFlowTraceTemplate* Template = Provider ? Provider->FindTemplate(TemplateId) : nullptr;
+	if (Template == nullptr)
+	{
+		return;
+	}
+
+	Provider->EnumerateScopes(TemplateId, Viewport.GetStartTime(), Viewport.GetEndTime(), [&Builder, Template](const FFlowTraceScope& Scope, const uint32 Row)
+	{
+		const FFlowTraceNodeStats* NodeStats = Template->Nodes.Find(Scope.NodeIndex);
+		Builder.AddEvent(Scope.StartTime, Scope.EndTime, Row, NodeStats ? *NodeStats->Name : TEXT("Unknown node"));
+	});
+}
+
+bool FFlowTimingTrack::FindScope(const double Time, const uint32 Row, FFlowTraceScope& OutScope) const
+{
+	bool bFound = false;
+
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(AnalysisSession);
+
+	if (const FFlowTraceProvider* Provider = AnalysisSession.ReadProvider<FFlowTraceProvider>(FFlowTraceProvider::ProviderName))
+	{
+		Provider->EnumerateScopes(TemplateId, Time, Time, [Row, &OutScope, &bFound](const FFlowTraceScope& Scope, const uint32 ScopeRow)
+		{
+			if (!bFound && ScopeRow == Row)
+			{
+				OutScope = Scope;
+				bFound = true;
+			}
+		});
+	}
+
+	return bFound;
+}
+
+void FFlowTimingTrack::InitTooltip(FTooltipDrawState& InOutTooltip, const ITimingEvent& InTooltipEvent) const
+{
+	InOutTooltip.ResetContent();
+
+	FFlowTraceScope Scope;
+	if (!InTooltipEvent.CheckTrack(this) || !InTooltipEvent.Is<FTimingEvent>()
+		|| !FindScope(InTooltipEvent.As<FTimingEvent>().GetStartTime(), InTooltipEvent.As<FTimingEvent>().GetDepth(), Scope))
+	{
+		InOutTooltip.UpdateLayout();
+		return;
+	}
+
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(AnalysisSession);
+
+	const FFlowTraceProvider* Provider = AnalysisSession.ReadProvider<FFlowTraceProvider>(FFlowTraceProvider::ProviderName);
+	const FFlowTraceTemplate* Template = Provider ? Provider->FindTemplate(TemplateId) : nullptr;
+	const FFlowTraceNodeStats* NodeStats = Template ? Template->Nodes.Find(Scope.NodeIndex) : nullptr;
+
+	InOutTooltip.AddTitle(NodeStats ? NodeStats->Name : TEXT("Unknown node"));
+	InOutTooltip.AddNameValueTextLine(TEXT("Input pin index:"), FString::FromInt(Scope.PinIndex));
+	InOutTooltip.AddNameValueTextLine(TEXT("Duration:"), FString::Printf(TEXT("%.3f ms"), (Scope.EndTime - Scope.StartTime) * 1000.0));
+	InOutTooltip.AddNameValueTextLine(TEXT("Instance:"), FString::Printf(TEXT("%u"), Scope.InstanceId));
+
+	if (NodeStats)
+	{
+		InOutTooltip.AddNameValueTextLine(TEXT("Node inputs in session:"), FString::FromInt(NodeStats->InputsNum));
+		InOutTooltip.AddNameValueTextLine(TEXT("Node outputs in session:"), FString::FromInt(NodeStats->OutputsNum));
+		InOutTooltip.AddNameValueTextLine(TEXT("Node time in session:"), FString::Printf(TEXT("%.3f ms"), NodeStats->InclusiveTime * 1000.0));
+	}
+
+	if (Template)
+	{
+		InOutTooltip.AddNameValueTextLine(TEXT("Asset:"), Template->Path);
+		InOutTooltip.AddNameValueTextLine(TEXT("Asset time in session:"), FString::Printf(TEXT("%.3f ms"), Template->TotalTime * 1000.0));
+		InOutTooltip.AddNameValueTextLine(TEXT("Asset instances in session:"), FString::FromInt(Template->InstancesNum));
+	}
+
+	InOutTooltip.UpdateLayout();
+}
+
+const TSharedPtr<const ITimingEvent> FFlowTimingTrack::SearchEvent(const FTimingEventSearchParameters& InSearchParameters) const
+{
+	TSharedPtr<const ITimingEvent> FoundEvent;
+
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(AnalysisSession);
+
+	if (const FFlowTraceProvider* Provider = AnalysisSession.ReadProvider<FFlowTraceProvider>(FFlowTraceProvider::ProviderName))
+	{
+		Provider->EnumerateScopes(TemplateId, InSearchParameters.StartTime, InSearchParameters.EndTime, [this, &InSearchParameters, &FoundEvent](const FFlowTraceScope& Scope, const uint32 Row)
+		{
+			if (!FoundEvent.IsValid() && InSearchParameters.EventFilter(Scope.StartTime, Scope.EndTime, Row))
+			{
+				InSearchParameters.EventMatched(Scope.StartTime, Scope.EndTime, Row);
+				FoundEvent = MakeShared<const FTimingEvent>(SharedThis(this), Scope.StartTime, Scope.EndTime, Row);
+			}
+		});
+	}
+
+	return FoundEvent;
+}
@@ -0,0 +1,40 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Insights/ViewModels/TimingEventsTrack.h"
+
+struct FFlowTraceScope;
+struct FFlowTraceTemplate;
+
+namespace TraceServices
+{
+	class IAnalysisSession;
+}
+
+// Inputs handled by nodes of a single Flow Asset, across all its instances
+class FFlowTimingTrack : public FTimingEventsTrack
+{
+	INSIGHTS_DECLARE_RTTI(FFlowTimingTrack, FTimingEventsTrack)
+
+public:
+	FFlowTimingTrack(const TraceServices::IAnalysisSession& InAnalysisSession, const uint32 InTemplateId, const FString& InTemplateName);
+
+	// Refreshes the track after new events of the template have been analyzed
+	void Update(const FFlowTraceTemplate& Template);
+
+	// FTimingEventsTrack
+	virtual void BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context) override;
+	virtual void InitTooltip(FTooltipDrawState& InOutTooltip, const ITimingEvent& InTooltipEvent) const override;
+	virtual const TSharedPtr<const ITimingEvent> SearchEvent(const FTimingEventSearchParameters& InSearchParameters) const override;
+	// --
+
+private:
+	// Finds the scope drawn at the time and row
+	bool FindScope(const double Time, const uint32 Row, FFlowTraceScope& OutScope) const;
+
+	const TraceServices::IAnalysisSession& AnalysisSession;
+	const uint32 TemplateId;
+
+	int32 ScopesNum = 0;
+};
@@ -0,0 +1,53 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowTimingViewExtender.h"
+#include "FlowTimingTrack.h"
+#include "FlowTraceProvider.h"
+
+#include "Insights/ITimingViewSession.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+void FFlowTimingViewExtender::OnBeginSession(UE::Insights::Timing::ITimingViewSession& InSession)
+{
+	SessionTracks.Add(&InSession);
+}
+
+void FFlowTimingViewExtender::OnEndSession(UE::Insights::Timing::ITimingViewSession& InSession)
+{
+	SessionTracks.Remove(&InSession);
+}
+
+void FFlowTimingViewExtender::Tick(UE::Insights::Timing::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession)
+{
+	FSessionTracks* Session = SessionTracks.Find(&InSession);
+	if (Session == nullptr)
+	{
+		return;
+	}
+
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(InAnalysisSession);
+
+	const FFlowTraceProvider* Provider = InAnalysisSession.ReadProvider<FFlowTraceProvider>(FFlowTraceProvider::ProviderName);
+	if (Provider == nullptr)
+	{
+		return;
+	}
+
+	Provider->EnumerateTemplates([&InSession, &InAnalysisSession, Session](const uint32 TemplateId, const FFlowTraceTemplate& Template)
+	{
+		if (Template.ScopesNum == 0)
+		{
+			return;
+		}
+
+		TSharedPtr<FFlowTimingTrack>& Track = Session->Tracks.FindOrAdd(TemplateId);
+		if (!Track.IsValid())
+		{
+			Track = MakeShared<FFlowTimingTrack>(InAnalysisSession, TemplateId, Template.Name);
+			InSession.AddScrollableTrack(Track);
+			InSession.InvalidateScrollableTracksOrder();
+		}
+
+		Track->Update(Template);
+	});
+}
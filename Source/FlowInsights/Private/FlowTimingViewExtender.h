@@ -0,0 +1,26 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "Insights/ITimingViewExtender.h"
+
+class FFlowTimingTrack;
+
+// Adds a timing track for every Flow Asset found in the analyzed trace
+class FFlowTimingViewExtender : public UE::Insights::Timing::ITimingViewExtender
+{
+public:
+	virtual void OnBeginSession(UE::Insights::Timing::ITimingViewSession& InSession) override;
+	virtual void OnEndSession(UE::Insights::Timing::ITimingViewSession& InSession) override;
+	virtual void Tick(UE::Insights::Timing::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession) override;
+
+private:
+	struct FSessionTracks
+	{
+		// By template ID
+		TMap<uint32, TSharedPtr<FFlowTimingTrack>> Tracks;
+	};
+
+	TMap<UE::Insights::Timing::ITimingViewSession*, FSessionTracks> SessionTracks;
+};
@@ -0,0 +1,94 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowTraceAnalyzer.h"
+#include "FlowTraceProvider.h"
+
+#include "TraceServices/Model/AnalysisSession.h"
+
+FFlowTraceAnalyzer::FFlowTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FFlowTraceProvider& InProvider)
+	: Session(InSession)
+	, Provider(InProvider)
+{
+}
+
+void FFlowTraceAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	FInterfaceBuilder& Builder = Context.InterfaceBuilder;
+
+	Builder.RouteEvent(RouteId_TemplateSpec, "Flow", "TemplateSpec");
+	Builder.RouteEvent(RouteId_NodeSpec, "Flow", "NodeSpec");
+	Builder.RouteEvent(RouteId_InstanceCreated, "Flow", "InstanceCreated");
+	Builder.RouteEvent(RouteId_InstanceStarted, "Flow", "InstanceStarted");
+	Builder.RouteEvent(RouteId_InstanceFinished, "Flow", "InstanceFinished");
+	Builder.RouteEvent(RouteId_InstanceRemoved, "Flow", "InstanceRemoved");
+	Builder.RouteEvent(RouteId_OutputTriggered, "Flow", "OutputTriggered");
+	Builder.RouteEvent(RouteId_InputExecuted, "Flow", "InputExecuted");
+}
+
+bool FFlowTraceAnalyzer::OnEvent(const uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	TraceServices::FAnalysisSessionEditScope EditScope(Session);
+
+	const FEventData& EventData = Context.EventData;
+	switch (RouteId)
+	{
+		case RouteId_TemplateSpec:
+		{
+			FString Path;
+			EventData.GetString("Path", Path);
+			Provider.AddTemplate(EventData.GetValue<uint32>("TemplateId"), Path);
+			break;
+		}
+		case RouteId_NodeSpec:
+		{
+			FString Name;
+			EventData.GetString("Name", Name);
+			Provider.AddNode(EventData.GetValue<uint32>("TemplateId"), EventData.GetValue<int32>("NodeIndex"), Name);
+			break;
+		}
+		case RouteId_InstanceCreated:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.AddInstance(EventData.GetValue<uint32>("InstanceId"), EventData.GetValue<uint32>("TemplateId"), Time);
+			break;
+		}
+		case RouteId_InstanceStarted:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.StartInstance(EventData.GetValue<uint32>("InstanceId"), Time);
+			break;
+		}
+		case RouteId_InstanceFinished:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.FinishInstance(EventData.GetValue<uint32>("InstanceId"), Time);
+			break;
+		}
+		case RouteId_InstanceRemoved:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.RemoveInstance(EventData.GetValue<uint32>("InstanceId"), Time);
+			break;
+		}
+		case RouteId_OutputTriggered:
+		{
+			Provider.AddOutput(EventData.GetValue<uint32>("InstanceId"), EventData.GetValue<int32>("NodeIndex"));
+			break;
+		}
+		case RouteId_InputExecuted:
+		{
+			FFlowTraceScope Scope;
+			Scope.StartTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("StartCycle"));
+			Scope.EndTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("EndCycle"));
+			Scope.InstanceId = EventData.GetValue<uint32>("InstanceId");
+			Scope.NodeIndex = EventData.GetValue<int32>("NodeIndex");
+			Scope.PinIndex = EventData.GetValue<uint16>("PinIndex");
+			Scope.ActivationType = EventData.GetValue<uint8>("ActivationType");
+			Provider.AddInputScope(Scope, EventData.GetValue<uint16>("Depth"));
+			break;
+		}
+		default: ;
+	}
+
+	return true;
+}
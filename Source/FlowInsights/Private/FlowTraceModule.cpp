@@ -0,0 +1,25 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowTraceModule.h"
+#include "FlowTraceAnalyzer.h"
+#include "FlowTraceProvider.h"
+
+static const FName FlowTraceModuleName(TEXT("Flow"));
+
+void FFlowTraceModule::GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo)
+{
+	OutModuleInfo.Name = FlowTraceModuleName;
+	OutModuleInfo.DisplayName = TEXT("Flow");
+}
+
+void FFlowTraceModule::OnAnalysisBegin(TraceServices::IAnalysisSession& InSession)
+{
+	const TSharedPtr<FFlowTraceProvider> Provider = MakeShared<FFlowTraceProvider>(InSession);
+	InSession.AddProvider(FFlowTraceProvider::ProviderName, Provider);
+	InSession.AddAnalyzer(new FFlowTraceAnalyzer(InSession, *Provider));
+}
+
+void FFlowTraceModule::GetLoggers(TArray<const TCHAR*>& OutLoggers)
+{
+	OutLoggers.Add(TEXT("Flow"));
+}
@@ -0,0 +1,183 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowTraceProvider.h"
+
+#include "Algo/BinarySearch.h"
+#include "Misc/Paths.h"
+
+const FName FFlowTraceProvider::ProviderName(TEXT("FlowTraceProvider"));
+
+FFlowTraceProvider::FFlowTraceProvider(TraceServices::IAnalysisSession& InSession)
+	: Session(InSession)
+{
+}
+
+FFlowTraceTemplate& FFlowTraceProvider::FindOrAddTemplate(const uint32 TemplateId)
+{
+	if (FFlowTraceTemplate* Template = Templates.Find(TemplateId))
+	{
+		return *Template;
+	}
+
+	FFlowTraceTemplate& NewTemplate = Templates.Add(TemplateId);
+	NewTemplate.Name = TemplateId == UnknownTemplateId ? TEXT("Unknown") : FString::Printf(TEXT("Template %u"), TemplateId);
+	return NewTemplate;
+}
+
+uint32 FFlowTraceProvider::GetTemplateId(const uint32 InstanceId) const
+{
+	const FFlowTraceInstance* Instance = Instances.Find(InstanceId);
+	return Instance ? Instance->TemplateId : UnknownTemplateId;
+}
+
+void FFlowTraceProvider::AddTemplate(const uint32 TemplateId, const FString& Path)
+{
+	Session.WriteAccessCheck();
+
+	FFlowTraceTemplate& Template = FindOrAddTemplate(TemplateId);
+	Template.Path = Path;
+	Template.Name = FPaths::GetBaseFilename(Path);
+}
+
+void FFlowTraceProvider::AddNode(const uint32 TemplateId, const int32 NodeIndex, const FString& Name)
+{
+	Session.WriteAccessCheck();
+
+	FindOrAddTemplate(TemplateId).Nodes.FindOrAdd(NodeIndex).Name = Name;
+}
+
+void FFlowTraceProvider::AddInstance(const uint32 InstanceId, const uint32 TemplateId, const double Time)
+{
+	Session.WriteAccessCheck();
+
+	// unique IDs are reused, the latest instance replaces the removed one
+	FFlowTraceInstance& Instance = Instances.Add(InstanceId);
+	Instance.TemplateId = TemplateId;
+	Instance.CreateTime = Time;
+
+	FindOrAddTemplate(TemplateId).InstancesNum++;
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FFlowTraceProvider::StartInstance(const uint32 InstanceId, const double Time)
+{
+	Session.WriteAccessCheck();
+
+	if (FFlowTraceInstance* Instance = Instances.Find(InstanceId))
+	{
+		Instance->StartTime = Time;
+	}
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FFlowTraceProvider::FinishInstance(const uint32 InstanceId, const double Time)
+{
+	Session.WriteAccessCheck();
+
+	if (FFlowTraceInstance* Instance = Instances.Find(InstanceId))
+	{
+		Instance->FinishTime = Time;
+	}
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FFlowTraceProvider::RemoveInstance(const uint32 InstanceId, const double Time)
+{
+	Session.WriteAccessCheck();
+
+	if (FFlowTraceInstance* Instance = Instances.Find(InstanceId))
+	{
+		Instance->RemoveTime = Time;
+	}
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FFlowTraceProvider::AddOutput(const uint32 InstanceId, const int32 NodeIndex)
+{
+	Session.WriteAccessCheck();
+
+	FindOrAddTemplate(GetTemplateId(InstanceId)).Nodes.FindOrAdd(NodeIndex).OutputsNum++;
+}
+
+void FFlowTraceProvider::AddInputScope(const FFlowTraceScope& Scope, const uint16 Depth)
+{
+	Session.WriteAccessCheck();
+
+	const uint32 TemplateId = GetTemplateId(Scope.InstanceId);
+	FFlowTraceTemplate& Template = FindOrAddTemplate(TemplateId);
+
+	if (Template.ScopesByDepth.Num() <= Depth)
+	{
+		Template.ScopesByDepth.SetNum(Depth + 1);
+	}
+	Template.ScopesByDepth[Depth].Add(Scope);
+	Template.ScopesNum++;
+
+	const double Duration = Scope.EndTime - Scope.StartTime;
+
+	FFlowTraceNodeStats& NodeStats = Template.Nodes.FindOrAdd(Scope.NodeIndex);
+	NodeStats.InputsNum++;
+	NodeStats.InclusiveTime += Duration;
+
+	// pending scopes started within this scope are nested in it, time of the same graph is already counted by them
+	double OwnTime = Duration;
+	for (int32 Index = PendingScopes.Num() - 1; Index >= 0 && PendingScopes[Index].StartTime >= Scope.StartTime; --Index)
+	{
+		if (PendingScopes[Index].TemplateId == TemplateId)
+		{
+			OwnTime -= PendingScopes[Index].OwnTime;
+		}
+	}
+	Template.TotalTime += OwnTime;
+
+	if (Depth == 0)
+	{
+		// nothing can be nested in a finished top-level scope anymore
+		PendingScopes.Reset();
+	}
+	else
+	{
+		PendingScopes.Add({TemplateId, Scope.StartTime, OwnTime});
+	}
+
+	Session.UpdateDurationSeconds(Scope.EndTime);
+}
+
+void FFlowTraceProvider::EnumerateTemplates(TFunctionRef<void(uint32 TemplateId, const FFlowTraceTemplate& Template)> Callback) const
+{
+	Session.ReadAccessCheck();
+
+	for (const TPair<uint32, FFlowTraceTemplate>& Template : Templates)
+	{
+		Callback(Template.Key, Template.Value);
+	}
+}
+
+void FFlowTraceProvider::EnumerateScopes(const uint32 TemplateId, const double StartTime, const double EndTime, TFunctionRef<void(const FFlowTraceScope& Scope, uint32 Row)> Callback) const
+{
+	Session.ReadAccessCheck();
+
+	const FFlowTraceTemplate* Template = Templates.Find(TemplateId);
+	if (Template == nullptr)
+	{
+		return;
+	}
+
+	uint32 Row = 0;
+	for (const TArray<FFlowTraceScope>& Scopes : Template->ScopesByDepth)
+	{
+		if (Scopes.IsEmpty())
+		{
+			continue;
+		}
+
+		// scopes don't overlap, so their end times are sorted as well
+		int32 Index = Algo::LowerBoundBy(Scopes, StartTime, &FFlowTraceScope::EndTime);
+		for (; Index < Scopes.Num() && Scopes[Index].StartTime <= EndTime; ++Index)
+		{
+			Callback(Scopes[Index], Row);
+		}
+
+		Row++;
+	}
+}
@@ -0,0 +1,110 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+// Handling of a single triggered input, including pins triggered by it
+struct FFlowTraceScope
+{
+	double StartTime = 0.0;
+	double EndTime = 0.0;
+	uint32 InstanceId = 0;
+	int32 NodeIndex = INDEX_NONE;
+	uint16 PinIndex = 0;
+	uint8 ActivationType = 0;
+};
+
+struct FFlowTraceNodeStats
+{
+	FString Name;
+	int32 InputsNum = 0;
+	int32 OutputsNum = 0;
+
+	// Time of handling inputs, including nodes triggered by this node
+	double InclusiveTime = 0.0;
+};
+
+struct FFlowTraceTemplate
+{
+	FString Path;
+	FString Name;
+
+	// By node index
+	TMap<int32, FFlowTraceNodeStats> Nodes;
+
+	// Call depths are global, so scopes of the same depth never overlap and every array is sorted by time
+	TArray<TArray<FFlowTraceScope>> ScopesByDepth;
+	int32 ScopesNum = 0;
+
+	// Time spent executing this graph, nested executions of the same graph are counted once
+	double TotalTime = 0.0;
+
+	int32 InstancesNum = 0;
+};
+
+struct FFlowTraceInstance
+{
+	uint32 TemplateId = 0;
+
+	double CreateTime = 0.0;
+	double StartTime = -1.0;
+	double FinishTime = -1.0;
+	double RemoveTime = -1.0;
+};
+
+/**
+ * Flow execution recorded in the trace, per Flow Asset template
+ * Written by FFlowTraceAnalyzer within session edit scope, read within session read scope
+ */
+class FFlowTraceProvider : public TraceServices::IProvider
+{
+public:
+	static const FName ProviderName;
+
+	// Template of instances created before the trace has been connected
+	static constexpr uint32 UnknownTemplateId = 0;
+
+	explicit FFlowTraceProvider(TraceServices::IAnalysisSession& InSession);
+
+	void AddTemplate(const uint32 TemplateId, const FString& Path);
+	void AddNode(const uint32 TemplateId, const int32 NodeIndex, const FString& Name);
+
+	void AddInstance(const uint32 InstanceId, const uint32 TemplateId, const double Time);
+	void StartInstance(const uint32 InstanceId, const double Time);
+	void FinishInstance(const uint32 InstanceId, const double Time);
+	void RemoveInstance(const uint32 InstanceId, const double Time);
+
+	void AddOutput(const uint32 InstanceId, const int32 NodeIndex);
+
+	// Scopes arrive once they end, so nested scopes arrive before their parents
+	void AddInputScope(const FFlowTraceScope& Scope, const uint16 Depth);
+
+	void EnumerateTemplates(TFunctionRef<void(uint32 TemplateId, const FFlowTraceTemplate& Template)> Callback) const;
+	const FFlowTraceTemplate* FindTemplate(const uint32 TemplateId) const { return Templates.Find(TemplateId); }
+	const FFlowTraceInstance* FindInstance(const uint32 InstanceId) const { return Instances.Find(InstanceId); }
+
+	// Calls back with scopes of the template overlapping the time range, Row is the index among non-empty depths
+	void EnumerateScopes(const uint32 TemplateId, const double StartTime, const double EndTime, TFunctionRef<void(const FFlowTraceScope& Scope, uint32 Row)> Callback) const;
+
+private:
+	FFlowTraceTemplate& FindOrAddTemplate(const uint32 TemplateId);
+	uint32 GetTemplateId(const uint32 InstanceId) const;
+
+	TraceServices::IAnalysisSession& Session;
+
+	TMap<uint32, FFlowTraceTemplate> Templates;
+	TMap<uint32, FFlowTraceInstance> Instances;
+
+	// Scopes that might still get a parent scope, cleared after every top-level scope
+	struct FPendingScope
+	{
+		uint32 TemplateId;
+		double StartTime;
+
+		// Scope duration minus time of nested scopes of the same template
+		double OwnTime;
+	};
+	TArray<FPendingScope> PendingScopes;
+};
@@ -0,0 +1,23 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Modules/ModuleInterface.h"
+
+class FFlowTraceModule;
+class FFlowTimingViewExtender;
+
+/**
+ * Analysis of the Flow trace channel (see FFlowTrace) in Unreal Insights
+ * Adds a timing track per Flow Asset, showing inputs handled by its nodes
+ */
+class FFlowInsightsModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	TSharedPtr<FFlowTraceModule> TraceModule;
+	TSharedPtr<FFlowTimingViewExtender> TimingViewExtender;
+};